@@ -44,6 +44,11 @@
  * these flags can be set unprompted. (For example, @ref THREAD_FLAG_MSG_WAITING
  * is set on a thread automatically with every message sent there).
  *
+ * The blocking functions of the lock-free queues wait for
+ * @ref SPSC_QUEUE_THREAD_FLAG (bit 13) and @ref MPSC_QUEUE_THREAD_FLAG
+ * (bit 12). Avoid these bits in threads that block on such a queue, or
+ * move the queue flags by defining the macros.
+ *
  * This API is optional and must be enabled by adding "core_thread_flags" to USEMODULE.
  *
  * @{
@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_util_mpsc_queue Lock-free MPSC queue
+ * @ingroup     core_util
+ * @brief       Lock-free multiple producer, single consumer queue of
+ *              fixed-size elements
+ *
+ * Any number of threads and ISRs may add elements to the queue, while exactly
+ * one thread (or ISR) takes them out. Producers reserve a slot by advancing
+ * the tail index with a compare-and-swap, copy their element into the slot
+ * and then mark the slot as ready. The consumer takes elements in the order
+ * their slots were reserved, so a producer that got preempted while copying
+ * holds back the elements queued after it until it is done.
+ *
+ * The compare-and-swap uses the C11 atomics builtins. On platforms without
+ * native support, these fall back to the implementation in `atomic_c11.c`,
+ * which only briefly disables interrupts.
+ *
+ * The storage needs room for a ready flag per slot in addition to the
+ * elements, use @ref MPSC_QUEUE_BUF_SIZE to allocate it:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static uint8_t _buf[MPSC_QUEUE_BUF_SIZE(sizeof(event_t *), 8)];
+ * static mpsc_queue_t _queue;
+ *
+ * mpsc_queue_init(&_queue, _buf, sizeof(event_t *), 8);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * mpsc_queue_get_blocking() is available with module `core_thread_flags`,
+ * mpsc_queue_put_blocking() additionally requires `core_thread_flags_group`
+ * as any number of producers may wait for space. Both only touch thread
+ * flags when the queue actually is empty or full. Blocked producers are woken
+ * once the consumer drained the queue to half of its capacity.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free MPSC queue interface
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assert.h"
+#include "atomic_utils.h"
+#include "modules.h"
+#include "sched.h"
+#if IS_USED(MODULE_CORE_THREAD_FLAGS_GROUP)
+#include "thread_flags_group.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Thread flag used by the blocking variants to wait for the queue
+ *
+ * Differs from @ref SPSC_QUEUE_THREAD_FLAG, so a thread consuming from both
+ * kinds of queues is not woken for the wrong one.
+ */
+#ifndef MPSC_QUEUE_THREAD_FLAG
+#define MPSC_QUEUE_THREAD_FLAG  (1u << 12)
+#endif
+
+/**
+ * @brief   Size of the storage needed for a queue of @p num elements of
+ *          @p elem_size bytes
+ */
+#define MPSC_QUEUE_BUF_SIZE(elem_size, num) (((elem_size) + 1) * (num))
+
+/**
+ * @brief   MPSC queue structure
+ */
+typedef struct {
+    uint8_t *buf;               /**< element storage */
+    uint8_t *ready;             /**< per slot flag: element was written */
+    unsigned mask;              /**< number of elements - 1 */
+    unsigned head;              /**< free running read index, consumer only */
+    unsigned tail;              /**< free running index of the next slot
+                                 *   to reserve */
+    size_t elem_size;           /**< size of a single element in bytes */
+    thread_t *reader;           /**< consumer blocked on the queue */
+    unsigned writers_waiting;   /**< number of producers waiting for space */
+    uint8_t reader_waiting;     /**< consumer waits for data */
+#if IS_USED(MODULE_CORE_THREAD_FLAGS_GROUP) || defined(DOXYGEN)
+    thread_flags_group_t writers;   /**< producers waiting for space */
+#endif
+} mpsc_queue_t;
+
+/**
+ * @brief   Initializes a queue
+ *
+ * @param[out] queue        Queue to initialize
+ * @param[in] buf           Storage of at least
+ *                          @ref MPSC_QUEUE_BUF_SIZE(@p elem_size, @p num) bytes
+ * @param[in] elem_size     Size of a single element in bytes
+ * @param[in] num           Number of elements, must be a power of two
+ */
+void mpsc_queue_init(mpsc_queue_t *queue, void *buf, size_t elem_size,
+                     unsigned num);
+
+/**
+ * @brief   Returns the number of elements in the queue
+ *
+ * @note    Includes elements that are still being copied in by a producer.
+ *
+ * @param[in] queue         Queue to check
+ *
+ * @return  number of queued elements
+ */
+static inline unsigned mpsc_queue_avail(const mpsc_queue_t *queue)
+{
+    unsigned head = atomic_load_unsigned(&queue->head);
+
+    return atomic_load_unsigned(&queue->tail) - head;
+}
+
+/**
+ * @brief   Adds an element to the queue
+ *
+ * @note    May be called by any thread or ISR.
+ *
+ * @param[in] queue         Queue to add the element to
+ * @param[in] elem          Element to copy into the queue
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the queue is full
+ */
+int mpsc_queue_put(mpsc_queue_t *queue, const void *elem);
+
+/**
+ * @brief   Takes the oldest element from the queue
+ *
+ * @note    May only be called by the consumer, may be called from an ISR.
+ *
+ * @param[in] queue         Queue to take the element from
+ * @param[out] elem         Buffer to copy the element to
+ *
+ * @return  0 on success
+ * @return  -EAGAIN if no element is ready
+ */
+int mpsc_queue_get(mpsc_queue_t *queue, void *elem);
+
+/**
+ * @brief   Adds an element to the queue, waits for space if the queue is full
+ *
+ * @note    Only available with module `core_thread_flags_group`. Must not be
+ *          called from ISRs. Uses @ref MPSC_QUEUE_THREAD_FLAG.
+ *
+ * @param[in] queue         Queue to add the element to
+ * @param[in] elem          Element to copy into the queue
+ */
+void mpsc_queue_put_blocking(mpsc_queue_t *queue, const void *elem);
+
+/**
+ * @brief   Takes the oldest element from the queue, waits for one if no
+ *          element is ready
+ *
+ * @note    Only available with module `core_thread_flags`. Must not be called
+ *          from ISRs. Uses @ref MPSC_QUEUE_THREAD_FLAG.
+ *
+ * @param[in] queue         Queue to take the element from
+ * @param[out] elem         Buffer to copy the element to
+ */
+void mpsc_queue_get_blocking(mpsc_queue_t *queue, void *elem);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_util_spsc_queue Lock-free SPSC queue
+ * @ingroup     core_util
+ * @brief       Lock-free single producer, single consumer queue of
+ *              fixed-size elements
+ *
+ * The queue passes elements of a fixed size from exactly one producer to
+ * exactly one consumer, e.g. from an ISR to a thread. The producer only ever
+ * writes the tail index and the consumer only ever writes the head index, so
+ * neither side needs to disable interrupts: both indices are accessed using
+ * @ref sys_atomic_utils, which also act as barriers for the element data.
+ *
+ * The blocking variants spsc_queue_put_blocking() and
+ * spsc_queue_get_blocking() are available with the module
+ * `core_thread_flags`. They only touch thread flags when the queue actually is
+ * full or empty, so the fast path stays free of any scheduler interaction.
+ * A producer blocked on a full queue is woken once the consumer drained the
+ * queue to half of its capacity, so it can refill several elements in one go.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static sample_t _buf[16];
+ * static spsc_queue_t _queue;
+ *
+ * spsc_queue_init(&_queue, _buf, sizeof(_buf[0]), ARRAY_SIZE(_buf));
+ *
+ * // producer, e.g. an ISR
+ * spsc_queue_put(&_queue, &sample);
+ *
+ * // consumer thread
+ * spsc_queue_get_blocking(&_queue, &sample);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free SPSC queue interface
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assert.h"
+#include "atomic_utils.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Thread flag used by the blocking variants to wait for the queue
+ *
+ * Differs from @ref MPSC_QUEUE_THREAD_FLAG, so a thread consuming from both
+ * kinds of queues is not woken for the wrong one. The blocking functions
+ * check the queue again after every wakeup, so sharing the flag with other
+ * users only costs spurious wakeups.
+ */
+#ifndef SPSC_QUEUE_THREAD_FLAG
+#define SPSC_QUEUE_THREAD_FLAG  (1u << 13)
+#endif
+
+/**
+ * @brief   SPSC queue structure
+ */
+typedef struct {
+    uint8_t *buf;           /**< element storage */
+    unsigned mask;          /**< number of elements - 1 */
+    unsigned head;          /**< free running read index, consumer only */
+    unsigned tail;          /**< free running write index, producer only */
+    size_t elem_size;       /**< size of a single element in bytes */
+    thread_t *reader;       /**< consumer blocked on the queue */
+    thread_t *writer;       /**< producer blocked on the queue */
+    uint8_t waiting;        /**< bitmask of blocked sides */
+} spsc_queue_t;
+
+/**
+ * @brief   Initializes a queue
+ *
+ * @param[out] queue        Queue to initialize
+ * @param[in] buf           Storage for @p num elements
+ * @param[in] elem_size     Size of a single element in bytes
+ * @param[in] num           Number of elements, must be a power of two
+ */
+static inline void spsc_queue_init(spsc_queue_t *queue, void *buf,
+                                   size_t elem_size, unsigned num)
+{
+    assert((num > 0) && !(num & (num - 1)));
+    *queue = (spsc_queue_t){
+        .buf = buf,
+        .mask = num - 1,
+        .elem_size = elem_size,
+    };
+}
+
+/**
+ * @brief   Returns the number of elements in the queue
+ *
+ * @param[in] queue         Queue to check
+ *
+ * @return  number of queued elements
+ */
+static inline unsigned spsc_queue_avail(const spsc_queue_t *queue)
+{
+    return atomic_load_unsigned(&queue->tail) -
+           atomic_load_unsigned(&queue->head);
+}
+
+/**
+ * @brief   Checks if the queue is empty
+ *
+ * @param[in] queue         Queue to check
+ *
+ * @return  true, if there is nothing to get
+ */
+static inline bool spsc_queue_empty(const spsc_queue_t *queue)
+{
+    return spsc_queue_avail(queue) == 0;
+}
+
+/**
+ * @brief   Adds an element to the queue
+ *
+ * @note    May only be called by the producer, may be called from ISRs.
+ *
+ * @param[in] queue         Queue to add the element to
+ * @param[in] elem          Element to copy into the queue
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the queue is full
+ */
+int spsc_queue_put(spsc_queue_t *queue, const void *elem);
+
+/**
+ * @brief   Takes the oldest element from the queue
+ *
+ * @note    May only be called by the consumer, may be called from ISRs.
+ *
+ * @param[in] queue         Queue to take the element from
+ * @param[out] elem         Buffer to copy the element to
+ *
+ * @return  0 on success
+ * @return  -EAGAIN if the queue is empty
+ */
+int spsc_queue_get(spsc_queue_t *queue, void *elem);
+
+/**
+ * @brief   Adds an element to the queue, waits for space if the queue is full
+ *
+ * @note    Only available with module `core_thread_flags`. Must not be called
+ *          from ISRs. Uses @ref SPSC_QUEUE_THREAD_FLAG.
+ *
+ * @param[in] queue         Queue to add the element to
+ * @param[in] elem          Element to copy into the queue
+ */
+void spsc_queue_put_blocking(spsc_queue_t *queue, const void *elem);
+
+/**
+ * @brief   Takes the oldest element from the queue, waits for one if the queue
+ *          is empty
+ *
+ * @note    Only available with module `core_thread_flags`. Must not be called
+ *          from ISRs. Uses @ref SPSC_QUEUE_THREAD_FLAG.
+ *
+ * @param[in] queue         Queue to take the element from
+ * @param[out] elem         Buffer to copy the element to
+ */
+void spsc_queue_get_blocking(spsc_queue_t *queue, void *elem);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
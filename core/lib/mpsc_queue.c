@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_util_mpsc_queue
+ * @{
+ *
+ * @file
+ * @brief       Lock-free MPSC queue implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "irq.h"
+#include "mpsc_queue.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+static inline void *_slot(const mpsc_queue_t *queue, unsigned idx)
+{
+    return &queue->buf[(idx & queue->mask) * queue->elem_size];
+}
+
+static inline bool _ready(mpsc_queue_t *queue, unsigned idx)
+{
+    return atomic_load_u8(&queue->ready[idx & queue->mask]);
+}
+
+void mpsc_queue_init(mpsc_queue_t *queue, void *buf, size_t elem_size,
+                     unsigned num)
+{
+    assert((num > 0) && !(num & (num - 1)));
+    *queue = (mpsc_queue_t){
+        .buf = buf,
+        .ready = (uint8_t *)buf + elem_size * num,
+        .mask = num - 1,
+        .elem_size = elem_size,
+    };
+    memset(queue->ready, 0, num);
+}
+
+int mpsc_queue_put(mpsc_queue_t *queue, const void *elem)
+{
+    unsigned tail;
+
+    do {
+        /* load head before tail: the head never overtakes the tail, so the
+         * difference cannot underflow even if we got preempted in between */
+        unsigned head = atomic_load_unsigned(&queue->head);
+
+        tail = atomic_load_unsigned(&queue->tail);
+        if ((tail - head) > queue->mask) {
+            return -ENOBUFS;
+        }
+    } while (!__atomic_compare_exchange_n(&queue->tail, &tail, tail + 1, false,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+    /* the slot is ours now, the consumer won't touch it until marked ready */
+    memcpy(_slot(queue, tail), elem, queue->elem_size);
+    atomic_store_u8(&queue->ready[tail & queue->mask], 1);
+
+    if (IS_USED(MODULE_CORE_THREAD_FLAGS) &&
+        atomic_load_u8(&queue->reader_waiting)) {
+        atomic_store_u8(&queue->reader_waiting, 0);
+        thread_flags_set(queue->reader, MPSC_QUEUE_THREAD_FLAG);
+    }
+    return 0;
+}
+
+int mpsc_queue_get(mpsc_queue_t *queue, void *elem)
+{
+    /* only the consumer writes the head, no need for atomic access */
+    unsigned head = queue->head;
+
+    if (!_ready(queue, head)) {
+        return -EAGAIN;
+    }
+    memcpy(elem, _slot(queue, head), queue->elem_size);
+    /* clear the flag before releasing the slot to the producers */
+    atomic_store_u8(&queue->ready[head & queue->mask], 0);
+    atomic_store_unsigned(&queue->head, head + 1);
+
+#if IS_USED(MODULE_CORE_THREAD_FLAGS_GROUP)
+    /* let blocked producers refill half of the queue at once instead of
+     * switching back and forth for every single element */
+    if ((atomic_load_unsigned(&queue->writers_waiting) != 0) &&
+        (mpsc_queue_avail(queue) <= (queue->mask + 1) / 2)) {
+        thread_flags_group_set(&queue->writers, MPSC_QUEUE_THREAD_FLAG);
+    }
+#endif
+    return 0;
+}
+
+#if IS_USED(MODULE_CORE_THREAD_FLAGS_GROUP)
+void mpsc_queue_put_blocking(mpsc_queue_t *queue, const void *elem)
+{
+    assert(!irq_is_in());
+    while (mpsc_queue_put(queue, elem) != 0) {
+        atomic_fetch_add_unsigned(&queue->writers_waiting, 1);
+        thread_flags_group_join(&queue->writers);
+        /* the consumer may have made room before it saw us waiting */
+        if (mpsc_queue_avail(queue) > queue->mask) {
+            thread_flags_wait_any(MPSC_QUEUE_THREAD_FLAG);
+        }
+        thread_flags_group_leave(&queue->writers);
+        atomic_fetch_sub_unsigned(&queue->writers_waiting, 1);
+    }
+}
+#endif
+
+#if IS_USED(MODULE_CORE_THREAD_FLAGS)
+void mpsc_queue_get_blocking(mpsc_queue_t *queue, void *elem)
+{
+    assert(!irq_is_in());
+    while (mpsc_queue_get(queue, elem) != 0) {
+        queue->reader = thread_get_active();
+        atomic_store_u8(&queue->reader_waiting, 1);
+        /* a producer may have finished its element before it saw us waiting */
+        if (!_ready(queue, queue->head)) {
+            thread_flags_wait_any(MPSC_QUEUE_THREAD_FLAG);
+        }
+        atomic_store_u8(&queue->reader_waiting, 0);
+    }
+}
+#endif
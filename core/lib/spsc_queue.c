@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_util_spsc_queue
+ * @{
+ *
+ * @file
+ * @brief       Lock-free SPSC queue implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "irq.h"
+#include "modules.h"
+#include "spsc_queue.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+static inline void *_slot(const spsc_queue_t *queue, unsigned idx)
+{
+    return &queue->buf[(idx & queue->mask) * queue->elem_size];
+}
+
+/* only checking a byte keeps the fast path cheap on platforms that lack
+ * lock-free pointer sized accesses */
+#define READER_WAITING  (0x1)
+#define WRITER_WAITING  (0x2)
+
+static inline void _wake(spsc_queue_t *queue, uint8_t side)
+{
+    if (!IS_USED(MODULE_CORE_THREAD_FLAGS) ||
+        !(atomic_load_u8(&queue->waiting) & side)) {
+        return;
+    }
+    atomic_fetch_and_u8(&queue->waiting, ~side);
+    thread_flags_set((side == READER_WAITING) ? queue->reader : queue->writer,
+                     SPSC_QUEUE_THREAD_FLAG);
+}
+
+int spsc_queue_put(spsc_queue_t *queue, const void *elem)
+{
+    /* only the producer writes the tail, no need for atomic access */
+    unsigned tail = queue->tail;
+
+    if ((tail - atomic_load_unsigned(&queue->head)) > queue->mask) {
+        return -ENOBUFS;
+    }
+    memcpy(_slot(queue, tail), elem, queue->elem_size);
+    /* publishing the new tail also acts as barrier for the data copied */
+    atomic_store_unsigned(&queue->tail, tail + 1);
+    _wake(queue, READER_WAITING);
+    return 0;
+}
+
+int spsc_queue_get(spsc_queue_t *queue, void *elem)
+{
+    /* only the consumer writes the head, no need for atomic access */
+    unsigned head = queue->head;
+    unsigned tail = atomic_load_unsigned(&queue->tail);
+
+    if (tail == head) {
+        return -EAGAIN;
+    }
+    memcpy(elem, _slot(queue, head), queue->elem_size);
+    atomic_store_unsigned(&queue->head, ++head);
+    /* let a blocked producer refill half of the queue at once instead of
+     * switching back and forth for every single element */
+    if ((tail - head) <= (queue->mask + 1) / 2) {
+        _wake(queue, WRITER_WAITING);
+    }
+    return 0;
+}
+
+#if IS_USED(MODULE_CORE_THREAD_FLAGS)
+void spsc_queue_put_blocking(spsc_queue_t *queue, const void *elem)
+{
+    assert(!irq_is_in());
+    while (spsc_queue_put(queue, elem) != 0) {
+        queue->writer = thread_get_active();
+        atomic_fetch_or_u8(&queue->waiting, WRITER_WAITING);
+        /* the consumer may have made room before it saw us waiting */
+        if (spsc_queue_avail(queue) > queue->mask) {
+            thread_flags_wait_any(SPSC_QUEUE_THREAD_FLAG);
+        }
+        atomic_fetch_and_u8(&queue->waiting, ~WRITER_WAITING);
+    }
+}
+
+void spsc_queue_get_blocking(spsc_queue_t *queue, void *elem)
+{
+    assert(!irq_is_in());
+    while (spsc_queue_get(queue, elem) != 0) {
+        queue->reader = thread_get_active();
+        atomic_fetch_or_u8(&queue->waiting, READER_WAITING);
+        /* the producer may have added an element before it saw us waiting */
+        if (spsc_queue_empty(queue)) {
+            thread_flags_wait_any(SPSC_QUEUE_THREAD_FLAG);
+        }
+        atomic_fetch_and_u8(&queue->waiting, ~READER_WAITING);
+    }
+}
+#endif
@@ -29,6 +29,20 @@ extern "C" {
 
 #include "net/if.h"
 
+/**
+ * @brief Number of frames a tap interface accepts for transmission at the
+ *        same time
+ *
+ * With 0, frames are written out synchronously by netdev_driver_t::send.
+ * Otherwise the device behaves like a network device with this number of
+ * transmit descriptors: the frames are confirmed asynchronously and a single
+ * NETDEV_EVENT_TX_COMPLETE is signaled for all frames sent in the meantime
+ * (see @ref NETOPT_TX_QUEUE_LEN).
+ */
+#ifndef CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+#define CONFIG_NETDEV_TAP_TX_QUEUE_LEN  (0U)
+#endif
+
 /* MARK: - Low-level ethernet driver for native tap interfaces */
 /**
  * @name Low-level ethernet driver for native tap interfaces
@@ -44,6 +58,13 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+#if (CONFIG_NETDEV_TAP_TX_QUEUE_LEN > 0) || defined(DOXYGEN)
+    int tx_res[CONFIG_NETDEV_TAP_TX_QUEUE_LEN]; /**< Results of the frames not
+                                                     confirmed yet, oldest first */
+    uint8_t tx_num;                     /**< Number of entries in tx_res */
+    bool tx_irq;                        /**< TX completion is to be signaled */
+    bool rx_irq;                        /**< A frame is to be received */
+#endif
 } netdev_tap_t;
 
 /**
@@ -46,6 +46,7 @@
 #include "async_read.h"
 
 #include "iolist.h"
+#include "irq.h"
 #include "net/eui64.h"
 #include "net/netdev.h"
 #include "net/netdev/eth.h"
@@ -95,6 +96,24 @@ static inline int _get_wired(netdev_t *netdev)
 
 static inline void _isr(netdev_t *netdev)
 {
+#if CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    unsigned state = irq_disable();
+    bool tx = dev->tx_irq;
+    bool rx = dev->rx_irq;
+
+    dev->tx_irq = false;
+    dev->rx_irq = false;
+    irq_restore(state);
+
+    if (tx && netdev->event_callback) {
+        netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+    }
+    /* reading without a frame pending would block */
+    if (!rx) {
+        return;
+    }
+#endif
     if (netdev->event_callback) {
         netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
     }
@@ -123,6 +142,17 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscuous(dev);
             res = sizeof(bool);
             break;
+#if CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+        case NETOPT_TX_QUEUE_LEN:
+            if (max_len < sizeof(uint8_t)) {
+                res = -EINVAL;
+            }
+            else {
+                *((uint8_t *)value) = CONFIG_NETDEV_TAP_TX_QUEUE_LEN;
+                res = sizeof(uint8_t);
+            }
+            break;
+#endif
         case NETOPT_IS_WIRED:
             if (!_get_wired(dev)) {
                 res = -ENOTSUP;
@@ -166,13 +196,26 @@ static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t value_len
 
 static int _confirm_send(netdev_t *netdev, void *info)
 {
-    (void)netdev;
     (void)info;
 
+#if CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    if (dev->tx_num == 0) {
+        return -EAGAIN;
+    }
+    int res = dev->tx_res[0];
+    dev->tx_num--;
+    memmove(&dev->tx_res[0], &dev->tx_res[1], dev->tx_num * sizeof(dev->tx_res[0]));
+    return res;
+#else
+    (void)netdev;
+
     /* confirm_send should not be called with synchronos send */
     assert(0);
 
     return -EOPNOTSUPP;
+#endif
 }
 
 static const netdev_driver_t netdev_driver_tap = {
@@ -303,7 +346,30 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     unsigned n;
     iolist_to_iovec(iolist, iov, &n);
 
+#if CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+    if (dev->tx_num >= CONFIG_NETDEV_TAP_TX_QUEUE_LEN) {
+        return -EBUSY;
+    }
+    int res = _native_writev(dev->tap_fd, iov, n);
+    if (res < 0) {
+        return res;
+    }
+    /* the frame is written out already, but it is confirmed like the frame
+     * of a transmit descriptor: with one event for all frames sent until the
+     * event is handled */
+    dev->tx_res[dev->tx_num++] = res;
+
+    unsigned state = irq_disable();
+    bool pending = dev->tx_irq;
+    dev->tx_irq = true;
+    irq_restore(state);
+    if (!pending) {
+        netdev_trigger_event_isr(netdev);
+    }
+    return 0;
+#else
     return _native_writev(dev->tap_fd, iov, n);
+#endif
 }
 
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params, int index) {
@@ -321,6 +387,9 @@ static void _tap_isr(int fd, void *arg) {
     netdev_t *netdev = &dev->netdev;
 
     if (netdev->event_callback) {
+#if CONFIG_NETDEV_TAP_TX_QUEUE_LEN
+        dev->rx_irq = true;
+#endif
         netdev_trigger_event_isr(netdev);
     }
     else {
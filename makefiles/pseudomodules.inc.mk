@@ -114,6 +114,8 @@ PSEUDOMODULES += gnrc_ipv6_auto_subnets_simple
 PSEUDOMODULES += gnrc_ipv6_classic
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
+PSEUDOMODULES += gnrc_ipv6_fwd_cache
+PSEUDOMODULES += gnrc_ipv6_fwd_workers
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
@@ -244,6 +246,27 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+##
+## @defgroup net_gnrc_tcp_congure gnrc_tcp_congure: Congestion control for GNRC TCP
+## @ingroup  net_gnrc_tcp
+## @brief    Congestion control for GNRC TCP using @ref sys_congure
+##
+## Without this module the amount of data in flight is only limited by the
+## window of the peer and @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE.
+## Select one of the implementations below, which pull in this module.
+## @{
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_abe gnrc_tcp_congure_abe: TCP Reno with ABE
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm with ABE](@ref sys_congure_abe)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_abe
+## @}
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -311,6 +334,7 @@ PSEUDOMODULES += netstats_neighbor_rssi
 PSEUDOMODULES += netstats_neighbor_lqi
 PSEUDOMODULES += netstats_neighbor_tx_time
 PSEUDOMODULES += netstats_ipv6
+PSEUDOMODULES += netstats_pktq
 PSEUDOMODULES += netstats_rpl
 PSEUDOMODULES += nimble
 PSEUDOMODULES += nimble_adv_ext
@@ -355,6 +379,7 @@ PSEUDOMODULES += psa_riot_hashes_sha_512_224
 PSEUDOMODULES += psa_riot_hashes_sha_512_256
 PSEUDOMODULES += psa_riot_hashes_hmac_sha256
 PSEUDOMODULES += fortuna_reseed
+PSEUDOMODULES += resmon_udp
 PSEUDOMODULES += riotboot_%
 PSEUDOMODULES += rtt_cmd
 PSEUDOMODULES += saul_adc
@@ -505,6 +530,13 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+## @addtogroup sys_trickle
+## @{
+## Scale down the redundancy constant in dense neighborhoods
+PSEUDOMODULES += trickle_adaptive
+## Count transmissions, suppressions and resets in trickle_t::stats
+PSEUDOMODULES += trickle_stats
+## @}
 
 # An umbrella module for the unicoap_driver_rfc7252_common_pdu
 # and unicoap_driver_rfc7252_common_messaging modules
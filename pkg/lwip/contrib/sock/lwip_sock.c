@@ -285,6 +285,16 @@ static int _sock_ep_to_netconn_pars(const struct _sock_tl_ep *local,
     return res;
 }
 
+int lwip_sock_ep_to_remote(const struct _sock_tl_ep *remote,
+                           ip_addr_t *remote_addr, u16_t *remote_port)
+{
+    int type = 0;
+    int res = _sock_ep_to_netconn_pars(NULL, remote, NULL, NULL, remote_addr,
+                                       remote_port, &type);
+
+    return (res < 0) ? res : 0;
+}
+
 static void _netconn_cb(struct netconn *conn, enum netconn_evt evt,
                         u16_t len)
 {
@@ -22,7 +22,10 @@
 #include "timex.h"
 
 #include "lwip/api.h"
+#include "lwip/ip.h"
+#include "lwip/netif.h"
 #include "lwip/opt.h"
+#include "lwip/pbuf.h"
 #include "lwip/sock_internal.h"
 #include "lwip/sys.h"
 #include "lwip/udp.h"
@@ -197,6 +200,130 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+static int _err_to_errno(err_t err)
+{
+    switch (err) {
+    case ERR_OK:
+        return 0;
+    case ERR_BUF:
+    case ERR_MEM:
+        return -ENOMEM;
+    case ERR_RTE:
+    case ERR_IF:
+        return -EHOSTUNREACH;
+    case ERR_VAL:
+    default:
+        return -EINVAL;
+    }
+}
+
+/* must be called with the TCPIP core lock held */
+static ssize_t _sendmmsg_one(struct udp_pcb *pcb, const sock_udp_mmsg_t *msg,
+                             ip_addr_t *addr, u16_t *port,
+                             struct netif **netif)
+{
+    struct pbuf *p;
+    size_t payload_len = 0;
+    err_t err;
+
+    if (msg->remote != NULL) {
+        ip_addr_t tmp_addr;
+        u16_t tmp_port = 0;
+        int res;
+
+        if (msg->remote->port == 0) {
+            return -EINVAL;
+        }
+        res = lwip_sock_ep_to_remote((struct _sock_tl_ep *)msg->remote,
+                                     &tmp_addr, &tmp_port);
+        if (res < 0) {
+            return res;
+        }
+        if ((*netif == NULL) || (tmp_port != *port) ||
+            !ip_addr_eq(&tmp_addr, addr)) {
+            /* remote changed: look up route again */
+            ip_addr_copy(*addr, tmp_addr);
+            *port = tmp_port;
+            if (msg->remote->netif != SOCK_ADDR_ANY_NETIF) {
+                *netif = netif_get_by_index(msg->remote->netif);
+            }
+            else {
+                *netif = ip_route(&pcb->local_ip, addr);
+            }
+        }
+    }
+    else if (!(pcb->flags & UDP_FLAGS_CONNECTED)) {
+        return -ENOTCONN;
+    }
+    else if (*netif == NULL) {
+        ip_addr_copy(*addr, pcb->remote_ip);
+        *port = pcb->remote_port;
+        *netif = ip_route(&pcb->local_ip, addr);
+    }
+    if (*netif == NULL) {
+        return -EHOSTUNREACH;
+    }
+
+    p = pbuf_alloc(PBUF_TRANSPORT, iolist_size(msg->snips), PBUF_RAM);
+    if (p == NULL) {
+        return -ENOMEM;
+    }
+    for (const iolist_t *snip = msg->snips; snip != NULL; snip = snip->iol_next) {
+        if (pbuf_take_at(p, snip->iol_base, snip->iol_len, payload_len) != ERR_OK) {
+            pbuf_free(p);
+            return -ENOMEM;
+        }
+        payload_len += snip->iol_len;
+    }
+    err = udp_sendto_if(pcb, p, addr, *port, *netif);
+    pbuf_free(p);
+
+    return (err == ERR_OK) ? (ssize_t)payload_len : _err_to_errno(err);
+}
+
+int sock_udp_sendmmsg(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num)
+{
+    struct netif *netif = NULL;
+    ip_addr_t addr;
+    u16_t port = 0;
+    unsigned i;
+
+    assert((msgs != NULL) || (num == 0));
+    if ((sock == NULL) || (sock->base.conn == NULL)) {
+        /* no PCB to batch on, send each datagram with its own netconn */
+        for (i = 0; i < num; i++) {
+            msgs[i].res = sock_udp_sendv_aux(sock, msgs[i].snips, msgs[i].remote,
+                                             msgs[i].aux);
+            if (msgs[i].res < 0) {
+                break;
+            }
+        }
+    }
+    else {
+        /* hand the whole batch to the stack under a single core lock instead
+         * of one tcpip thread round-trip per datagram */
+        LOCK_TCPIP_CORE();
+        for (i = 0; i < num; i++) {
+            msgs[i].res = _sendmmsg_one(sock->base.conn->pcb.udp, &msgs[i],
+                                        &addr, &port, &netif);
+            if (msgs[i].res < 0) {
+                break;
+            }
+        }
+        UNLOCK_TCPIP_CORE();
+#if IS_ACTIVE(SOCK_HAS_ASYNC)
+        if ((i > 0) && (sock->base.async_cb.udp != NULL)) {
+            sock->base.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                                    sock->base.async_cb_arg);
+        }
+#endif
+    }
+    if ((i == 0) && (num > 0)) {
+        return msgs[0].res;
+    }
+    return i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -53,6 +53,8 @@ int lwip_sock_create(struct netconn **conn, const struct _sock_tl_ep *local,
                       uint16_t flags, int type);
 uint16_t lwip_sock_bind_addr_to_netif(const ip_addr_t *bind_addr);
 int lwip_sock_get_addr(struct netconn *conn, struct _sock_tl_ep *ep, u8_t local);
+int lwip_sock_ep_to_remote(const struct _sock_tl_ep *remote,
+                           ip_addr_t *remote_addr, u16_t *remote_port);
 #if defined(MODULE_LWIP_SOCK_UDP) || defined(MODULE_LWIP_SOCK_IP)
 int lwip_sock_recv(struct netconn *conn, uint32_t timeout, struct netbuf **buf);
 #endif
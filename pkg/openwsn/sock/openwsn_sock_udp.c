@@ -355,6 +355,25 @@ void sock_udp_close(sock_udp_t *sock)
     }
 }
 
+int sock_udp_sendmmsg(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num)
+{
+    unsigned i;
+
+    /* OpenWSN queues every packet on its own, so there is nothing to share
+     * between the datagrams of a batch */
+    for (i = 0; i < num; i++) {
+        msgs[i].res = sock_udp_sendv_aux(sock, msgs[i].snips, msgs[i].remote,
+                                         msgs[i].aux);
+        if (msgs[i].res < 0) {
+            break;
+        }
+    }
+    if ((i == 0) && (num > 0)) {
+        return msgs[0].res;
+    }
+    return i;
+}
+
 int sock_udp_get_local(sock_udp_t *sock, sock_udp_ep_t *ep)
 {
     if (sock->gen_sock.local.family == AF_UNSPEC) {
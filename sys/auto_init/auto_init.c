@@ -80,6 +80,11 @@ extern void auto_init_event_thread(void);
 AUTO_INIT(auto_init_event_thread,
           AUTO_INIT_PRIO_MOD_EVENT_THREAD);
 #endif
+#if IS_USED(MODULE_AUTO_INIT_RESMON)
+extern void resmon_init(void);
+AUTO_INIT(resmon_init,
+          AUTO_INIT_PRIO_MOD_RESMON);
+#endif
 #if IS_USED(MODULE_SYS_BUS)
 extern void auto_init_sys_bus(void);
 AUTO_INIT(auto_init_sys_bus,
@@ -82,6 +82,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_WDT_EVENT                        1085
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_RESMON
+/**
+ * @brief   resource monitor priority
+ */
+#define AUTO_INIT_PRIO_MOD_RESMON                       1087
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SYS_BUS
 /**
  * @brief   sys bus priority
@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Work-stealing thread pool implementation
+ *
+ * The per-worker queues are only ever accessed for a handful of
+ * instructions, so they are protected by disabling interrupts, as done by
+ * the event queues themselves.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "event/threadpool.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define QUEUE_MASK      (CONFIG_EVENT_THREADPOOL_QUEUE_SIZE - 1)
+
+static_assert((CONFIG_EVENT_THREADPOOL_QUEUE_SIZE & QUEUE_MASK) == 0,
+              "CONFIG_EVENT_THREADPOOL_QUEUE_SIZE must be a power of two");
+
+static inline unsigned _queued(const event_threadpool_worker_t *worker)
+{
+    return worker->bottom - worker->top;
+}
+
+/* must be called with interrupts disabled */
+static bool _push(event_threadpool_worker_t *worker, event_threadpool_job_t *job)
+{
+    if (_queued(worker) >= CONFIG_EVENT_THREADPOOL_QUEUE_SIZE) {
+        return false;
+    }
+    job->state = EVENT_THREADPOOL_JOB_QUEUED;
+    worker->jobs[worker->bottom++ & QUEUE_MASK] = job;
+    return true;
+}
+
+/* take newest job from the back, used by the owner of the queue */
+static event_threadpool_job_t *_pop(event_threadpool_worker_t *worker)
+{
+    event_threadpool_job_t *job = NULL;
+    unsigned state = irq_disable();
+
+    if (_queued(worker) > 0) {
+        job = worker->jobs[--worker->bottom & QUEUE_MASK];
+        job->state = EVENT_THREADPOOL_JOB_RUNNING;
+    }
+    irq_restore(state);
+    return job;
+}
+
+/* take oldest job from the front, used by other workers */
+static event_threadpool_job_t *_steal(event_threadpool_worker_t *victim)
+{
+    event_threadpool_job_t *job = NULL;
+    unsigned state = irq_disable();
+
+    if (_queued(victim) > 0) {
+        job = victim->jobs[victim->top++ & QUEUE_MASK];
+        job->state = EVENT_THREADPOOL_JOB_RUNNING;
+    }
+    irq_restore(state);
+    return job;
+}
+
+static event_threadpool_job_t *_next_job(event_threadpool_t *pool,
+                                         event_threadpool_worker_t *worker)
+{
+    event_threadpool_job_t *job = _pop(worker);
+
+    if (job != NULL) {
+        return job;
+    }
+    /* start with the neighbor to not have all idle workers hit the same
+     * victim */
+    unsigned self = worker - pool->workers;
+    for (unsigned i = 1; i < pool->numof; i++) {
+        event_threadpool_worker_t *victim = &pool->workers[(self + i) % pool->numof];
+
+        if ((job = _steal(victim)) != NULL) {
+            DEBUG("event_threadpool: worker %u stole %p from worker %u\n",
+                  self, (void *)job, (unsigned)(victim - pool->workers));
+            worker->stolen++;
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static void _wake(event_threadpool_t *pool, event_threadpool_worker_t *preferred)
+{
+    event_threadpool_worker_t *target = NULL;
+    unsigned state = irq_disable();
+
+    if (preferred->idle) {
+        target = preferred;
+    }
+    else {
+        /* preferred worker is busy, wake any idle worker to steal the job */
+        for (unsigned i = 0; i < pool->numof; i++) {
+            if (pool->workers[i].idle) {
+                target = &pool->workers[i];
+                break;
+            }
+        }
+    }
+    if (target != NULL) {
+        /* prevent waking the same worker twice for two jobs */
+        target->idle = false;
+    }
+    irq_restore(state);
+    if (target != NULL) {
+        thread_flags_set(thread_get(target->pid), EVENT_THREADPOOL_FLAG);
+    }
+}
+
+NORETURN static void *_worker_thread(void *arg)
+{
+    event_threadpool_worker_t *worker = arg;
+    event_threadpool_t *pool = worker->pool;
+
+    while (1) {
+        event_threadpool_job_t *job = _next_job(pool, worker);
+
+        if (job == NULL) {
+            unsigned state = irq_disable();
+
+            worker->idle = true;
+            irq_restore(state);
+            /* a job may have been queued between the last check and setting
+             * the idle flag, so check again before going to sleep */
+            if ((job = _next_job(pool, worker)) == NULL) {
+                thread_flags_wait_any(EVENT_THREADPOOL_FLAG);
+                continue;
+            }
+            state = irq_disable();
+            worker->idle = false;
+            irq_restore(state);
+        }
+        job->super.handler(&job->super);
+        worker->executed++;
+        job->state = EVENT_THREADPOOL_JOB_DONE;
+        if ((job->done_queue != NULL) && (job->done != NULL)) {
+            event_post(job->done_queue, job->done);
+        }
+    }
+    UNREACHABLE();
+}
+
+void event_threadpool_init(event_threadpool_t *pool,
+                           event_threadpool_worker_t *workers, unsigned numof,
+                           char *stacks, size_t stack_size, uint8_t priority,
+                           const char *name)
+{
+    assert((pool != NULL) && (workers != NULL) && (numof > 0));
+    pool->workers = workers;
+    pool->numof = numof;
+    pool->next = 0;
+    memset(workers, 0, numof * sizeof(*workers));
+    for (unsigned i = 0; i < numof; i++) {
+        workers[i].pool = pool;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        /* workers with a higher priority run before thread_create()
+         * returns, but they only need their PID once jobs are submitted */
+        workers[i].pid = thread_create(&stacks[i * stack_size], stack_size,
+                                       priority, 0, _worker_thread,
+                                       &workers[i], name);
+        assert(pid_is_valid(workers[i].pid));
+    }
+}
+
+static event_threadpool_worker_t *_self(event_threadpool_t *pool)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    for (unsigned i = 0; i < pool->numof; i++) {
+        if (pool->workers[i].pid == pid) {
+            return &pool->workers[i];
+        }
+    }
+    return NULL;
+}
+
+int event_threadpool_submit(event_threadpool_t *pool,
+                            event_threadpool_job_t *job)
+{
+    event_threadpool_worker_t *worker = NULL;
+    unsigned first, state;
+
+    assert((pool != NULL) && (job != NULL) && (job->super.handler != NULL));
+    assert((job->state != EVENT_THREADPOOL_JOB_QUEUED) &&
+           (job->state != EVENT_THREADPOOL_JOB_RUNNING));
+
+    state = irq_disable();
+    if (irq_is_in() || ((worker = _self(pool)) == NULL)) {
+        /* submitted from outside the pool: distribute round-robin */
+        first = pool->next;
+        pool->next = (pool->next + 1) % pool->numof;
+    }
+    else {
+        /* keep jobs spawned by a worker local, others will steal them */
+        first = worker - pool->workers;
+    }
+    worker = NULL;
+    for (unsigned i = 0; i < pool->numof; i++) {
+        event_threadpool_worker_t *tmp = &pool->workers[(first + i) % pool->numof];
+
+        if (_push(tmp, job)) {
+            worker = tmp;
+            break;
+        }
+    }
+    irq_restore(state);
+    if (worker == NULL) {
+        return -ENOBUFS;
+    }
+    _wake(pool, worker);
+    return 0;
+}
+
+bool event_threadpool_cancel(event_threadpool_t *pool,
+                             event_threadpool_job_t *job)
+{
+    bool res = false;
+    unsigned state = irq_disable();
+
+    if (job->state != EVENT_THREADPOOL_JOB_QUEUED) {
+        irq_restore(state);
+        return false;
+    }
+    for (unsigned i = 0; !res && (i < pool->numof); i++) {
+        event_threadpool_worker_t *worker = &pool->workers[i];
+
+        for (unsigned j = worker->top; j != worker->bottom; j++) {
+            if (worker->jobs[j & QUEUE_MASK] != job) {
+                continue;
+            }
+            /* close the gap to keep the order of the remaining jobs */
+            for (unsigned k = j; (k + 1) != worker->bottom; k++) {
+                worker->jobs[k & QUEUE_MASK] = worker->jobs[(k + 1) & QUEUE_MASK];
+            }
+            worker->bottom--;
+            job->state = EVENT_THREADPOOL_JOB_IDLE;
+            res = true;
+            break;
+        }
+    }
+    irq_restore(state);
+    return res;
+}
+
+unsigned event_threadpool_pending(const event_threadpool_t *pool)
+{
+    unsigned res = 0;
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < pool->numof; i++) {
+        res += _queued(&pool->workers[i]);
+    }
+    irq_restore(state);
+    return res;
+}
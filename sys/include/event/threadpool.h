@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_event
+ * @brief       Work-stealing thread pool for independent jobs
+ *
+ * Usage
+ * =====
+ *
+ * The module `event_threadpool` provides a pool of worker threads that
+ * process independent jobs, e.g. signature verification, compression or file
+ * system writes, without blocking the event thread(s) provided by
+ * `event_thread`.
+ *
+ * Every worker owns a bounded double-ended queue of jobs. A worker takes jobs
+ * from the back of its own queue (newest first), jobs submitted from outside
+ * the pool are distributed round-robin over the workers. Once a worker runs
+ * out of jobs, it steals the oldest job from the front of another worker's
+ * queue, so a long running job does not hold back the jobs queued behind it
+ * as long as there is an idle worker. Idle workers sleep on a thread flag.
+ *
+ * A job is an @ref event_t extended with an optional completion event. The
+ * completion event is posted to the given @ref event_queue_t once the job's
+ * handler returned, so the result can be picked up by the thread that
+ * submitted the job:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+ * static event_threadpool_worker_t _workers[2];
+ * static event_threadpool_t _pool;
+ *
+ * static void _verify(event_t *ev)
+ * {
+ *     // CPU heavy work, runs on one of the workers
+ * }
+ *
+ * static void _verified(event_t *ev)
+ * {
+ *     // runs in the thread handling EVENT_PRIO_MEDIUM
+ * }
+ *
+ * static event_t _done = { .handler = _verified };
+ * static event_threadpool_job_t _job;
+ *
+ * [...]
+ * event_threadpool_init(&_pool, _workers, ARRAY_SIZE(_workers),
+ *                       &_stacks[0][0], sizeof(_stacks[0]),
+ *                       THREAD_PRIORITY_MAIN + 1, "pool");
+ * event_threadpool_job_init(&_job, _verify, EVENT_PRIO_MEDIUM, &_done);
+ * event_threadpool_submit(&_pool, &_job);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    RIOT schedules threads on a single core, so the workers do not
+ *          run truly in parallel. Still, the pool allows to run CPU heavy
+ *          jobs at a lower priority than the event thread and to interleave
+ *          them with blocking I/O of other jobs.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool API
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of jobs that can be queued per worker
+ *
+ * @note    Must be a power of two.
+ */
+#ifndef CONFIG_EVENT_THREADPOOL_QUEUE_SIZE
+#define CONFIG_EVENT_THREADPOOL_QUEUE_SIZE  (8U)
+#endif
+
+/**
+ * @brief   Thread flag used to wake up idle workers
+ */
+#ifndef EVENT_THREADPOOL_FLAG
+#define EVENT_THREADPOOL_FLAG               (THREAD_FLAG_EVENT)
+#endif
+
+/**
+ * @brief   Job states
+ */
+enum {
+    EVENT_THREADPOOL_JOB_IDLE,      /**< job was not submitted yet */
+    EVENT_THREADPOOL_JOB_QUEUED,    /**< job is waiting for a worker */
+    EVENT_THREADPOOL_JOB_RUNNING,   /**< job is being executed */
+    EVENT_THREADPOOL_JOB_DONE,      /**< job's handler returned */
+};
+
+/**
+ * @brief   Thread pool job
+ */
+typedef struct {
+    event_t super;              /**< event whose handler is run by a worker */
+    event_queue_t *done_queue;  /**< queue to post event_threadpool_job_t::done
+                                 *   to on completion, may be NULL */
+    event_t *done;              /**< completion event, may be NULL */
+    volatile uint8_t state;     /**< state of the job */
+} event_threadpool_job_t;
+
+/**
+ * @brief   Forward declaration of the thread pool
+ */
+typedef struct event_threadpool event_threadpool_t;
+
+/**
+ * @brief   Worker of a thread pool
+ *
+ * @note    Members are internal, the structure needs to be provided by the
+ *          user of the pool only to allocate the memory.
+ */
+typedef struct {
+    event_threadpool_t *pool;   /**< pool the worker belongs to */
+    /**
+     * @brief   Queued jobs, jobs[top] to jobs[bottom - 1] (modulo size)
+     */
+    event_threadpool_job_t *jobs[CONFIG_EVENT_THREADPOOL_QUEUE_SIZE];
+    unsigned top;               /**< index of oldest job (stolen first) */
+    unsigned bottom;            /**< index after newest job (run first) */
+    kernel_pid_t pid;           /**< PID of the worker thread */
+    bool idle;                  /**< worker waits for jobs */
+    uint32_t executed;          /**< number of jobs executed */
+    uint32_t stolen;            /**< number of jobs stolen from others */
+} event_threadpool_worker_t;
+
+/**
+ * @brief   Thread pool
+ */
+struct event_threadpool {
+    event_threadpool_worker_t *workers; /**< workers of the pool */
+    unsigned numof;                     /**< number of workers */
+    unsigned next;                      /**< worker to queue the next
+                                         *   externally submitted job at */
+};
+
+/**
+ * @brief   Initializes a thread pool and starts its workers
+ *
+ * @pre `(pool != NULL) && (workers != NULL) && (numof > 0)`
+ *
+ * @param[out] pool         The thread pool
+ * @param[in] workers       Memory for @p numof workers
+ * @param[in] numof         Number of workers
+ * @param[in] stacks        Stack memory for all workers, @p numof stacks of
+ *                          @p stack_size bytes each
+ * @param[in] stack_size    Size of the stack of a single worker
+ * @param[in] priority      Priority of the worker threads
+ * @param[in] name          Name of the worker threads
+ */
+void event_threadpool_init(event_threadpool_t *pool,
+                           event_threadpool_worker_t *workers, unsigned numof,
+                           char *stacks, size_t stack_size, uint8_t priority,
+                           const char *name);
+
+/**
+ * @brief   Initializes a job
+ *
+ * @param[out] job          The job
+ * @param[in] handler       Handler executed by a worker, gets
+ *                          event_threadpool_job_t::super passed
+ * @param[in] done_queue    Queue to post @p done to on completion,
+ *                          may be NULL
+ * @param[in] done          Event to post on completion, may be NULL
+ */
+static inline void event_threadpool_job_init(event_threadpool_job_t *job,
+                                             event_handler_t handler,
+                                             event_queue_t *done_queue,
+                                             event_t *done)
+{
+    *job = (event_threadpool_job_t){
+        .super = { .handler = handler },
+        .done_queue = done_queue,
+        .done = done,
+    };
+}
+
+/**
+ * @brief   Submits a job to the pool
+ *
+ * When called from a worker of @p pool, the job is queued at that worker,
+ * otherwise the workers are used round-robin. If the selected worker's queue
+ * is full, the other workers are tried.
+ *
+ * @pre     @p job is not queued or running
+ *
+ * @param[in] pool  The thread pool
+ * @param[in] job   The job
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the queues of all workers are full
+ */
+int event_threadpool_submit(event_threadpool_t *pool,
+                            event_threadpool_job_t *job);
+
+/**
+ * @brief   Removes a job from the pool, if it was not started yet
+ *
+ * @param[in] pool  The thread pool
+ * @param[in] job   The job
+ *
+ * @return  true if the job was removed before it was started
+ * @return  false if the job was not queued (anymore)
+ */
+bool event_threadpool_cancel(event_threadpool_t *pool,
+                             event_threadpool_job_t *job);
+
+/**
+ * @brief   Checks if the handler of a job has returned
+ *
+ * @param[in] job   The job
+ *
+ * @return  true, if the job is done
+ */
+static inline bool event_threadpool_job_done(const event_threadpool_job_t *job)
+{
+    return job->state == EVENT_THREADPOOL_JOB_DONE;
+}
+
+/**
+ * @brief   Returns the number of jobs waiting for a worker
+ *
+ * @param[in] pool  The thread pool
+ *
+ * @return  number of queued jobs
+ */
+unsigned event_threadpool_pending(const event_threadpool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
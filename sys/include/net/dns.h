@@ -48,6 +48,16 @@ extern "C" {
 #define DNS_CLASS_IN            (1)
 /** @} */
 
+/**
+ * @name    Header flags and response codes
+ * @{
+ */
+#define DNS_FLAG_QR             (0x8000)    /**< message is a response */
+#define DNS_FLAG_RCODE_MASK     (0x000f)    /**< mask of the response code */
+#define DNS_RCODE_NOERROR       (0)         /**< no error */
+#define DNS_RCODE_NXDOMAIN      (3)         /**< name does not exist */
+/** @} */
+
 /**
  * @name    Field lengths
  * @{
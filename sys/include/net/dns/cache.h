@@ -19,15 +19,22 @@
  * @file
  * @brief   DNS cache definitions
  *
- * This implements a simple DNS cache for A and AAAA entries.
+ * This implements a DNS cache for A and AAAA entries.
  *
- * The cache eviction strategy is based on the remaining time to live
- * of the cache entries, so the first entry to expire will be evicted.
+ * Entries are kept in a hash table keyed by the full domain name, so a
+ * lookup only compares the names that share a bucket. Names longer than
+ * @ref CONFIG_DNS_CACHE_NAME_LEN - 1 characters are not cached. If
+ * @ref CONFIG_DNS_CACHE_NAME_LEN is 0, no names are stored and entries are
+ * instead keyed by a 64 bit fingerprint of the name, trading a negligible
+ * chance of a wrong answer for memory.
  *
- * This is fine if there are only few cache entries and cache eviction
- * is unlikely.
- * If there is communication to many different hosts, the addition of a
- * least-recently used counter could likely improve the behavior.
+ * The entries are also ordered by their expiry in a min-heap, so expired
+ * entries are dropped without scanning the cache. If the cache is full, the
+ * first entry to expire is evicted, unless it lives longer than the new one.
+ *
+ * Negative answers (the name does not exist or has no address of the queried
+ * family) can be cached with dns_cache_add_negative(), so repeated lookups of
+ * such names do not reach the DNS server until the entry expires.
  *
  * @author  Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
@@ -47,6 +54,32 @@ extern "C" {
 #define CONFIG_DNS_CACHE_SIZE   4
 #endif
 
+/**
+ * @brief   Number of hash buckets of the DNS cache
+ */
+#ifndef CONFIG_DNS_CACHE_BUCKETS
+#define CONFIG_DNS_CACHE_BUCKETS    CONFIG_DNS_CACHE_SIZE
+#endif
+
+/**
+ * @brief   Maximum length of a cached domain name, including the terminating
+ *          zero byte
+ *
+ * Set to 0 to key the entries by a fingerprint of the name instead.
+ */
+#ifndef CONFIG_DNS_CACHE_NAME_LEN
+#define CONFIG_DNS_CACHE_NAME_LEN   64
+#endif
+
+/**
+ * @brief   Lifetime of negative entries in seconds
+ *
+ * Used by the DNS clients for answers stating that a name has no address.
+ */
+#ifndef CONFIG_DNS_CACHE_NEGATIVE_TTL
+#define CONFIG_DNS_CACHE_NEGATIVE_TTL   30
+#endif
+
 /**
  * @brief   Handle to cache A records
  */
@@ -70,7 +103,9 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
- * @return      <= 0 otherwise
+ * @return      -ENOENT if a negative entry states that @p domain_name has no
+ *              address of @p family
+ * @return      0 if there is no entry for @p domain_name
  */
 int dns_cache_query(const char *domain_name, void *addr_out, int family);
 
@@ -83,6 +118,19 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   ttl             lifetime of the entry in seconds
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+/**
+ * @brief Add a negative entry for a DNS name to the DNS cache
+ *
+ * Until the entry expires or an address is added for @p domain_name,
+ * dns_cache_query() returns -ENOENT for @p domain_name and @p family. A
+ * negative entry for AF_UNSPEC also covers AF_INET and AF_INET6.
+ *
+ * @param[in]   domain_name     DNS name that has no address
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ * @param[in]   ttl             lifetime of the entry in seconds
+ */
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl);
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -100,6 +148,14 @@ static inline void dns_cache_add(const char *domain_name, const void *addr,
     (void)addr_len;
     (void)ttl;
 }
+
+static inline void dns_cache_add_negative(const char *domain_name, int family,
+                                          uint32_t ttl)
+{
+    (void)domain_name;
+    (void)family;
+    (void)ttl;
+}
 #endif
 
 #ifdef __cplusplus
@@ -20,6 +20,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -113,6 +114,23 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
 int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
                         void *addr_out, uint32_t *ttl);
 
+/**
+ * @brief   Checks if a DNS response message states that the queried name has
+ *          no address
+ *
+ * This is the case if the name does not exist (NXDOMAIN) or if it has no
+ * records of the queried type, see
+ * [RFC 2308](https://tools.ietf.org/html/rfc2308). Such an answer can be
+ * cached with @ref dns_cache_add_negative().
+ *
+ * @param[in] buf           The message to check.
+ * @param[in] len           Length of @p buf.
+ *
+ * @return  true, if @p buf is a negative response
+ * @return  false otherwise
+ */
+bool dns_msg_reply_is_negative(const uint8_t *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
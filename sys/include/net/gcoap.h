@@ -55,7 +55,8 @@
  * the path characters (digit and capital precede lower case). Use
  * gcoap_register_listener() at application startup to pass in these resources,
  * wrapped in a gcoap_listener_t. Also see _Server path matching_ in the base
- * [nanocoap](group__net__nanocoap.html) documentation.
+ * [nanocoap](group__net__nanocoap.html) documentation. The handlers of a
+ * listener must not modify the request, see _Creating a response_ below.
  *
  * gcoap itself defines a resource for `/.well-known/core` discovery, which
  * lists all of the registered paths. See the _Resource list creation_ section
@@ -70,6 +71,11 @@
  * reuses the request buffer. See `examples/networking/coap/gcoap/client.c` for a simple
  * example of a callback.
  *
+ * The callback must not modify the request itself: With GNRC, gcoap parses
+ * requests right in the packet buffer of the network stack to avoid copying
+ * them, and the packet may be shared with other receivers. So only write to
+ * the buffer passed to the callback, which may or may not hold the request.
+ *
  * Here is the expected sequence for a callback function:
  *
  * Read request completely and parse request payload, if any. Use the
@@ -193,6 +199,26 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Multiple observers ###
+ *
+ * Several clients may observe the same resource. The notification is
+ * serialized only once: gcoap_obs_init() writes the header for the first
+ * observer, and gcoap_obs_send() sends the same options and payload to every
+ * observer of the resource, writing only a fresh header with the observer's
+ * token and a new message ID for each of them. For plain UDP, the
+ * notifications are handed to the network stack in batches of up to
+ * CONFIG_GCOAP_OBS_SEND_BATCH with sock_udp_sendmmsg().
+ *
+ * Notifications are non-confirmable by default. With
+ * CONFIG_GCOAP_OBS_CON_INTERVAL set, every n-th notification to an observer
+ * is confirmable, so gcoap learns whether the observer is still there. While a
+ * confirmable notification is not acknowledged, further notifications to that
+ * observer are skipped, and the next one is sent confirmable again. If
+ * CONFIG_GCOAP_OBS_CON_FAILS_MAX confirmable notifications in a row are not
+ * acknowledged within CONFIG_GCOAP_OBS_ACK_TIMEOUT_MS, the registration is
+ * removed (see RFC 7641, sec. 4.5). Confirmable notifications are not
+ * retransmitted, the next notification carries the current state anyway.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -553,9 +579,7 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of Observe clients
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
- *       Therefore, every stored observer is associated with a different resource.
- *       If you have only one observable resource, you could set this value to 1.
+ * A client observing several resources is stored only once.
  */
 #ifndef CONFIG_GCOAP_OBS_CLIENTS_MAX
 #define CONFIG_GCOAP_OBS_CLIENTS_MAX   (2)
@@ -565,10 +589,7 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of local notifying endpoint addresses
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
- *       Therefore, every stored local endpoint alias is associated with an observation context
- *       of a different resource.
- *       If you have only one observable resource, you could set this value to 1.
+ * Registrations received on the same local address share an entry.
  */
 #ifndef CONFIG_GCOAP_OBS_NOTIFIERS_MAX
 #define CONFIG_GCOAP_OBS_NOTIFIERS_MAX  (2)
@@ -578,14 +599,56 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of registrations for Observable resources
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
- *       Therefore, every stored observation context is associated with a different resource.
- *       If you have only one observable resource, you could set this value to 1.
+ * Every observer of a resource takes one registration.
  */
 #ifndef CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of notifications handed to the network stack at
+ *          once by gcoap_obs_send()
+ *
+ * Each element of the batch takes a header buffer of
+ * `4 + GCOAP_TOKENLEN_MAX` bytes and a few pointers on the stack of the
+ * calling thread.
+ */
+#ifndef CONFIG_GCOAP_OBS_SEND_BATCH
+#define CONFIG_GCOAP_OBS_SEND_BATCH     (4)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Send every n-th notification to an observer confirmable
+ *
+ * 0 sends all notifications non-confirmable and disables the tracking of
+ * unresponsive observers.
+ */
+#ifndef CONFIG_GCOAP_OBS_CON_INTERVAL
+#define CONFIG_GCOAP_OBS_CON_INTERVAL   (0)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Time in milliseconds to wait for the acknowledgement of a
+ *          confirmable notification
+ *
+ * Until then, further notifications to the observer are skipped.
+ */
+#ifndef CONFIG_GCOAP_OBS_ACK_TIMEOUT_MS
+#define CONFIG_GCOAP_OBS_ACK_TIMEOUT_MS (CONFIG_COAP_ACK_TIMEOUT_MS * 2)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of unacknowledged confirmable notifications in a row after
+ *          which an observer is removed
+ */
+#ifndef CONFIG_GCOAP_OBS_CON_FAILS_MAX
+#define CONFIG_GCOAP_OBS_CON_FAILS_MAX  (2)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -676,6 +739,29 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of resource path index slots shared by all listeners
+ *
+ * Only used with module `nanocoap_path_index`. Every listener registered
+ * with the default request matcher takes the next power of two above 4/3 of
+ * its number of resources, see @ref net_nanocoap_path_index. Listeners
+ * registered when the slots are used up fall back to the linear search.
+ */
+#ifndef CONFIG_GCOAP_PATH_INDEX_SLOTS
+#define CONFIG_GCOAP_PATH_INDEX_SLOTS     (128)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of listeners with a resource path index
+ *
+ * Only used with module `nanocoap_path_index`.
+ */
+#ifndef CONFIG_GCOAP_PATH_INDEX_LISTENERS_MAX
+#define CONFIG_GCOAP_PATH_INDEX_LISTENERS_MAX (4)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -866,6 +952,13 @@ typedef struct {
     uint16_t last_msgid;                /**< Message ID of last notification */
     unsigned token_len;                 /**< Actual length of token attribute */
     gcoap_socket_t socket;              /**< Transport type to observer */
+    uint32_t con_sent;                  /**< Time in ms the unacknowledged
+                                         *   confirmable notification was sent */
+    uint8_t con_countdown;              /**< Notifications until the next
+                                         *   confirmable one */
+    uint8_t con_fails;                  /**< Unacknowledged confirmable
+                                         *   notifications in a row */
+    bool con_pending;                   /**< Waiting for an ACK */
 } gcoap_observe_memo_t;
 
 /**
@@ -1061,9 +1154,11 @@ static inline ssize_t gcoap_response(coap_pkt_t *pdu, uint8_t *buf,
 
 /**
  * @brief   Initializes a CoAP Observe notification packet on a buffer, for the
- *          observer registered for a resource
+ *          observers registered for a resource
  *
- * First verifies that an observer has been registered for the resource.
+ * First verifies that an observer has been registered for the resource. The
+ * header is written for the first observer, gcoap_obs_send() replaces it for
+ * the others.
  *
  * @post    If this function returns @see GCOAP_OBS_INIT_OK you have to call
  *          @ref gcoap_obs_send() afterwards to release a mutex.
@@ -1081,16 +1176,19 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                    const coap_resource_t *resource);
 
 /**
- * @brief   Sends a buffer containing a CoAP Observe notification to the
- *          observer registered for a resource
+ * @brief   Sends a buffer containing a CoAP Observe notification to all
+ *          observers registered for a resource
  *
- * Assumes a single observer for a resource.
+ * The options and payload in @p buf are sent unchanged to every observer,
+ * only the header and token are rewritten for each of them. The message type
+ * follows the policy described in @ref net_gcoap, observers still waiting
+ * to acknowledge a confirmable notification are skipped.
  *
- * @param[in] buf Buffer containing the PDU
+ * @param[in] buf Buffer containing the PDU, as initialized by gcoap_obs_init()
  * @param[in] len Length of the buffer
  * @param[in] resource Resource to send
  *
- * @return  length of the packet
+ * @return  length of the packet, if it was sent to at least one observer
  * @return  0 if cannot send
  */
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
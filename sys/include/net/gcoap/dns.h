@@ -104,6 +104,8 @@ extern "C" {
  * @return  -ENOBUFS, if length of received CoAP body is greater than
  *          @ref CONFIG_DNS_MSG_LEN.
  * @return  -ENOENT, if Zone-ID of the URI can not be found locally.
+ * @return  -ENOENT, if the server stated that @p domain_name has no address
+ *          of @p family. This is cached with @ref dns_cache_add_negative().
  * @return  -ENOMSG, if CoAP response did not contain a DNS response.
  * @return  -ENOTRECOVERABLE, on gCoAP-internal error.
  * @return  -ENOTSUP, if credential can not be added for to client.
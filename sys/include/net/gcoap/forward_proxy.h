@@ -12,7 +12,11 @@
  * @defgroup    net_gcoap_forward_proxy    GCoAP Forward Proxy
  * @ingroup     net_gcoap
  * @brief       Forward proxy implementation for GCoAP
- * @note Does not support CoAPS yet.
+ *
+ * Requests for `coaps://` URIs are forwarded over DTLS, if `gcoap_dtls` is
+ * used. The DTLS session to a server is kept by gcoap and reused for
+ * subsequent requests.
+ *
  * @see <a href="https://tools.ietf.org/html/rfc7252#section-5.7.2">
  *          RFC 7252
  *      </a>
@@ -46,6 +50,31 @@ extern "C" {
 #ifndef CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS
 #define CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS     ((CONFIG_COAP_ACK_TIMEOUT_MS / 4) * 3)
 #endif
+
+/**
+ * @brief Maximum number of client requests the forward proxy handles at once
+ *
+ * Identical GET or FETCH requests arriving while one of them is forwarded
+ * to the server are not forwarded again, but wait for the same response.
+ * Such a waiting request only takes a client slot, not a request memo of
+ * gcoap (see @ref CONFIG_GCOAP_REQ_WAITING_MAX), so there may be more client
+ * slots than memos.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX
+#define CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX      (2 * CONFIG_GCOAP_REQ_WAITING_MAX)
+#endif
+
+/**
+ * @brief Maximum length of a forwarded request that can be shared by clients
+ *
+ * Every client slot keeps the code, options and payload of its forwarded
+ * request, to tell identical requests apart from ones that only have the same
+ * hash. Longer requests are always forwarded on their own, 0 disables sharing
+ * responses.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN
+#define CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN     (64)
+#endif
 /** @} */
 
 /**
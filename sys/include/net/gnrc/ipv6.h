@@ -58,6 +58,17 @@
  *    @ref GNRC_NETAPI_MSG_TYPE_SND with the packet reversed into send order and
  *    the (if necessary prepended) gnrc_netif_hdr_t::if_pid has the appropriate
  *    link-layer destination addresses to the next hop towards the destination.
+ *    With the `gnrc_ipv6_fwd_cache` module, the outgoing interface and the
+ *    link-layer address of the next hop are remembered per destination and
+ *    receiving interface (see @ref CONFIG_GNRC_IPV6_FWD_CACHE_SIZE), so
+ *    further packets of that flow are handed to the outgoing interface
+ *    directly after the hop limit was decremented.
+ *    With the `gnrc_ipv6_fwd_workers` module, packets are sharded by the hash
+ *    of their source and destination address to
+ *    @ref CONFIG_GNRC_IPV6_FWD_WORKERS_NUMOF additional threads (see
+ *    gnrc_ipv6_fwd_workers_dispatch()), which forward packets concurrently to
+ *    the IPv6 thread. Packets for this host are handed back to the IPv6
+ *    thread by the workers.
  *
  * ## `GNRC_NETAPI_MSG_TYPE_SND`
  *
@@ -97,6 +108,9 @@
  * @author      Oliver Hahm <oliver.hahm@inria.fr>
  */
 
+#include <stdbool.h>
+
+#include "modules.h"
 #include "sched.h"
 #include "thread.h"
 
@@ -206,6 +220,34 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_STATIC_LLADDR_NETDEV_MASK 0ULL
 #endif
 
+/**
+ * @brief   Number of flows the forwarding cache of the `gnrc_ipv6_fwd_cache`
+ *          module remembers the next hop for
+ *
+ * Flows are identified by their destination address and receiving interface.
+ * Only unicast flows with a global destination whose next hop is reachable
+ * are cached. The cache is flushed with gnrc_ipv6_fwd_cache_flush() whenever
+ * the @ref net_gnrc_ipv6_nib "NIB" or the addresses of an interface change.
+ */
+#ifndef CONFIG_GNRC_IPV6_FWD_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_FWD_CACHE_SIZE        (8U)
+#endif
+
+/**
+ * @brief   Number of forwarding worker threads of the `gnrc_ipv6_fwd_workers`
+ *          module
+ *
+ * The workers run in addition to the IPv6 thread with the same priority and
+ * stack size. As the workers are only scheduled concurrently on platforms
+ * with more than one thread running at the same time, they mostly decouple
+ * the flows on single-core platforms: each worker has its own message queue,
+ * so a burst of one flow does not overflow the queue of the IPv6 thread for
+ * all other flows.
+ */
+#ifndef CONFIG_GNRC_IPV6_FWD_WORKERS_NUMOF
+#define CONFIG_GNRC_IPV6_FWD_WORKERS_NUMOF     (2U)
+#endif
+
 /**
  * @brief Message queue size to use for the IPv6 thread.
  */
@@ -269,6 +311,50 @@ kernel_pid_t gnrc_ipv6_init(void);
  */
 ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Invalidates all entries of the forwarding cache
+ *
+ * Needs to be called whenever a change may alter the next hop, outgoing
+ * interface, or link-layer address of the next hop for a destination, or
+ * whether a destination is an address of this host. May be called from any
+ * thread. No-op without the `gnrc_ipv6_fwd_cache` module.
+ */
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE) || defined(DOXYGEN)
+void gnrc_ipv6_fwd_cache_flush(void);
+#else
+static inline void gnrc_ipv6_fwd_cache_flush(void)
+{
+}
+#endif
+
+/**
+ * @brief   Hands a received packet to a forwarding worker of the
+ *          `gnrc_ipv6_fwd_workers` module
+ *
+ * Used by the lower layers instead of @ref gnrc_netapi_dispatch_receive() for
+ * @ref GNRC_NETTYPE_IPV6 packets. Packets of the same flow are always handed
+ * to the same worker, so their order is kept. Only unicast packets to a
+ * destination that is not link-local are considered, and only if no other
+ * thread than the IPv6 thread subscribed to @ref GNRC_NETTYPE_IPV6.
+ *
+ * @param[in] pkt   A received packet in receive order, starting with the IPv6
+ *                  header.
+ *
+ * @return  true, if @p pkt was handed to a worker or released because the
+ *          message queue of the worker was full.
+ * @return  false, if @p pkt needs to be dispatched regularly. Always false
+ *          without the `gnrc_ipv6_fwd_workers` module.
+ */
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS) || defined(DOXYGEN)
+bool gnrc_ipv6_fwd_workers_dispatch(gnrc_pktsnip_t *pkt);
+#else
+static inline bool gnrc_ipv6_fwd_workers_dispatch(gnrc_pktsnip_t *pkt)
+{
+    (void)pkt;
+    return false;
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
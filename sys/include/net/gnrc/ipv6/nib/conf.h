@@ -323,6 +323,20 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Number of hash buckets of the off-link entry index
+ *
+ * With a large number of off-link entries (e.g. the downward routes a
+ * @ref net_gnrc_rpl "RPL" root learns from DAOs) the linear search of the
+ * off-link entries on every route added, removed or looked up gets expensive.
+ * If not 0, off-link entries are additionally hashed by their prefix, so
+ * exact prefix lookups and host routes only need to visit the entries in one
+ * bucket. Costs 2 bytes per bucket and per off-link entry.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE       (0)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
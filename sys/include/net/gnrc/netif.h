@@ -29,6 +29,7 @@
  * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
  */
 
+#include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -172,9 +173,25 @@ typedef struct {
      *
      * @details Only provided with module `netdev_new_api`
      *
-     * This needs to be freed by gnrc_netif once TX is done
+     * This needs to be freed by gnrc_netif once TX is done. With several
+     * frames in transmission, this is the oldest one.
      */
     gnrc_pktsnip_t *tx_pkt;
+#if (CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1) || defined(DOXYGEN)
+    /**
+     * @brief   Frames transmitted after gnrc_netif_t::tx_pkt, oldest first
+     *
+     * @details Only provided with module `netdev_new_api` and
+     *          @ref CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1
+     */
+    gnrc_pktsnip_t *tx_queue[CONFIG_GNRC_NETIF_TX_QUEUE_LEN - 1];
+    uint8_t tx_queue_len;       /**< Number of frames in gnrc_netif_t::tx_queue */
+    uint8_t tx_queue_max;       /**< Number of frames the device accepts in
+                                 *   addition to gnrc_netif_t::tx_pkt */
+    uint8_t tx_queue_pktq;      /**< Bitmap of the frames in
+                                 *   gnrc_netif_t::tx_queue that were taken
+                                 *   from the packet queue */
+#endif
 #endif
 #if (GNRC_NETIF_L2ADDR_MAXLEN > 0) || DOXYGEN
     /**
@@ -220,6 +237,11 @@ typedef struct {
     kernel_pid_t pid;                       /**< PID of the network interface's thread */
 } gnrc_netif_t;
 
+#if CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1
+static_assert(CONFIG_GNRC_NETIF_TX_QUEUE_LEN <= 8,
+              "gnrc_netif_t::tx_queue_pktq has one bit per frame in gnrc_netif_t::tx_queue");
+#endif
+
 /**
  * @brief   Check if the device belonging to the given netif uses the legacy
  *          netdev API
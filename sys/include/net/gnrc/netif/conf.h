@@ -55,6 +55,21 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_MSG_QUEUE_SIZE_EXP  (4U)
 #endif
 
+/**
+ * @brief       Maximum number of frames handed to a network device at the same
+ *              time
+ *
+ * Devices that advertise several transmit slots via @ref NETOPT_TX_QUEUE_LEN
+ * get up to this number of frames before the first one was confirmed. Frames
+ * completed in the meantime are confirmed in bulk on the next
+ * NETDEV_EVENT_TX_COMPLETE and the slots are refilled from the packet queue
+ * (see @ref net_gnrc_netif_pktq) at once. Only used with the netdev API
+ * providing netdev_driver_t::confirm_send. At most 8.
+ */
+#ifndef CONFIG_GNRC_NETIF_TX_QUEUE_LEN
+#define CONFIG_GNRC_NETIF_TX_QUEUE_LEN        (1U)
+#endif
+
 /**
  * @brief       Packet queue pool size for all network interfaces
  *
@@ -79,6 +94,33 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Number of flows the data packets in the packet queue of a
+ *              network interface are distributed to
+ *
+ * Data packets are hashed by their IPv6 source and destination address (or
+ * by their link-layer destination, if the IPv6 header is already compressed)
+ * into this number of flows. The flows are served by deficit round robin, so
+ * a single bulk flow can't delay the packets of all other flows. With 1, data
+ * packets are sent in the order they were queued.
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FLOWS          (4U)
+#endif
+
+/**
+ * @brief       Number of bytes a flow of the packet queue may send per round
+ *
+ * Must be between 64 and 32768, so the deficit of a flow fits into 16 bits.
+ *
+ * @see         CONFIG_GNRC_NETIF_PKTQ_FLOWS
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_QUANTUM
+#define CONFIG_GNRC_NETIF_PKTQ_QUANTUM        (1280U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -117,6 +159,20 @@ extern "C" {
                                                DHCPV6_CLIENT_ADDRS_NUMOF)
 #endif
 
+/**
+ * @brief   Number of destinations per interface the selected source address
+ *          is remembered for
+ *
+ * gnrc_netif_ipv6_addr_best_src() only applies the rules of
+ * [RFC 6724](https://tools.ietf.org/html/rfc6724#section-5) for destinations
+ * not in this cache. The cache of an interface is flushed when the addresses
+ * of the interface or their states change, or when a prefix list entry is
+ * added or removed. Set to 0 to disable the cache.
+ */
+#ifndef CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE
+#define CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE (4U)
+#endif
+
 /**
  * @brief   Maximum number of multicast groups per interface
  *
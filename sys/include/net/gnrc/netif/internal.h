@@ -211,6 +211,34 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
                                            const ipv6_addr_t *dst,
                                            bool ll_only);
 
+/**
+ * @brief   Flushes the source addresses cached by
+ *          gnrc_netif_ipv6_addr_best_src() for an interface
+ *
+ * Changes of the addresses of @p netif and their states are detected without
+ * this. It only needs to be called for changes of other state the selection
+ * depends on, e.g. the prefix list. Does not block, so it can be called while
+ * holding other locks.
+ *
+ * @param[in] netif the network interface, NULL for all interfaces
+ *
+ * @note    Only available with @ref net_gnrc_ipv6 "gnrc_ipv6".
+ */
+static inline void gnrc_netif_ipv6_src_cache_flush(gnrc_netif_t *netif)
+{
+#if CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE > 0
+    if (netif != NULL) {
+        netif->ipv6.src_cache_gen++;
+        return;
+    }
+    while ((netif = gnrc_netif_iter(netif))) {
+        netif->ipv6.src_cache_gen++;
+    }
+#else
+    (void)netif;
+#endif
+}
+
 /**
  * @brief   Gets an interface by an address (incl. multicast groups) assigned
  *          to it.
@@ -18,6 +18,9 @@
  * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "modules.h"
 
 #include "evtimer_msg.h"
@@ -70,6 +73,20 @@ extern "C" {
 #define GNRC_NETIF_IPV6_ADDRS_FLAGS_ANYCAST                (0x20U)
 /** @} */
 
+#if (CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE > 0) || DOXYGEN
+/**
+ * @brief   Entry of the source address cache of an interface
+ *
+ * @see     CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE
+ */
+typedef struct {
+    ipv6_addr_t dst;    /**< destination address */
+    uint8_t idx;        /**< index of the source in gnrc_netif_ipv6_t::addrs */
+    bool ll_only;       /**< only link-local sources were considered */
+    bool used;          /**< the entry is in use */
+} gnrc_netif_ipv6_src_cache_t;
+#endif
+
 /**
  * @brief   IPv6 component for @ref gnrc_netif_t
  *
@@ -255,6 +272,30 @@ typedef struct {
      * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
      */
     uint16_t mtu;
+#if (CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE > 0) || DOXYGEN
+    /**
+     * @brief   Source addresses selected for recent destinations
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6" and
+     *          @ref CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE > 0
+     */
+    gnrc_netif_ipv6_src_cache_t src_cache[CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE];
+    /**
+     * @brief   gnrc_netif_ipv6_t::addrs_flags when the source address cache
+     *          was flushed last
+     *
+     * Changes of the addresses' states are detected by comparing against this.
+     */
+    uint8_t src_cache_flags[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    /**
+     * @brief   Incremented to request a flush of the source address cache
+     *
+     * @see     gnrc_netif_ipv6_src_cache_flush()
+     */
+    volatile uint8_t src_cache_gen;
+    uint8_t src_cache_gen_seen; /**< last gnrc_netif_ipv6_t::src_cache_gen seen */
+    uint8_t src_cache_next;     /**< next entry of the cache to replace */
+#endif
 } gnrc_netif_ipv6_t;
 
 #ifdef __cplusplus
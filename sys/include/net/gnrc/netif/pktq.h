@@ -34,6 +34,12 @@ extern "C" {
 /**
  * @brief   Puts a packet into the packet send queue of a network interface
  *
+ * ICMPv6 packets (NDP, RPL, ...) are put into class
+ * @ref GNRC_NETIF_PKTQ_CLASS_CTRL, all other packets into class
+ * @ref GNRC_NETIF_PKTQ_CLASS_DATA. If the pool is depleted, a packet of class
+ * @ref GNRC_NETIF_PKTQ_CLASS_CTRL replaces the oldest packet of the longest
+ * flow of @p netif, which is then released.
+ *
  * @pre `netif != NULL`
  * @pre `pkt != NULL`
  *
@@ -56,6 +62,11 @@ unsigned gnrc_netif_pktq_usage(void);
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
+ * Packets pushed back with @ref gnrc_netif_pktq_push_back() and packets of
+ * class @ref GNRC_NETIF_PKTQ_CLASS_CTRL are returned first, in the order they
+ * were queued. Packets of class @ref GNRC_NETIF_PKTQ_CLASS_DATA are returned
+ * by deficit round robin over @ref CONFIG_GNRC_NETIF_PKTQ_FLOWS flows.
+ *
  * @pre `netif != NULL`
  *
  * @param[in] netif A network interface. May not be NULL.
@@ -63,26 +74,15 @@ unsigned gnrc_netif_pktq_usage(void);
  * @return  A packet on success
  * @return  NULL when the queue is empty
  */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ) || defined(DOXYGEN)
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif);
+#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-    assert(netif != NULL);
-
-    gnrc_pktsnip_t *pkt = NULL;
-    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(
-        &netif->send_queue.queue
-    );
-
-    if (entry != NULL) {
-        pkt = entry->pkt;
-        entry->pkt = NULL;
-    }
-    return pkt;
-#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return NULL;
-#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 
 /**
  * @brief   Schedule a dequeue notification to network interface
@@ -130,7 +130,8 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
-    return (netif->send_queue.queue == NULL);
+    return (netif->send_queue.queue == NULL) &&
+           (netif->send_queue.data_len == 0);
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return false;
@@ -23,18 +23,61 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
+#include "net/netstats.h"
 #include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @name    Classes of packets in the packet queue
+ * @{
+ */
+/**
+ * @brief   ICMPv6 packets (NDP, RPL, ...)
+ *
+ * Always sent before any packet of @ref GNRC_NETIF_PKTQ_CLASS_DATA
+ */
+#define GNRC_NETIF_PKTQ_CLASS_CTRL      (0U)
+#define GNRC_NETIF_PKTQ_CLASS_DATA      (1U)    /**< all other packets */
+#define GNRC_NETIF_PKTQ_CLASS_NUMOF     (2U)    /**< number of classes */
+/** @} */
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
-    gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    /**
+     * @brief   Packets sent before all others: packets pushed back and
+     *          packets of class @ref GNRC_NETIF_PKTQ_CLASS_CTRL
+     */
+    gnrc_pktqueue_t *queue;
+    /**
+     * @brief   Packets of class @ref GNRC_NETIF_PKTQ_CLASS_DATA by flow
+     */
+    gnrc_pktqueue_t *flows[CONFIG_GNRC_NETIF_PKTQ_FLOWS];
+    /**
+     * @brief   Bytes each flow may still send in the current round
+     */
+    uint16_t deficit[CONFIG_GNRC_NETIF_PKTQ_FLOWS];
+    /**
+     * @brief   Number of packets queued in each flow
+     */
+    uint16_t flow_len[CONFIG_GNRC_NETIF_PKTQ_FLOWS];
+    uint16_t data_len;          /**< number of packets queued in all flows */
+    uint8_t flow;               /**< flow currently served */
+#if IS_USED(MODULE_NETSTATS_PKTQ) || defined(DOXYGEN)
+    /**
+     * @brief   Statistics per class of packets
+     */
+    netstats_pktq_t stats[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
@@ -415,6 +415,25 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
  */
 #define CONFIG_GNRC_RPL_DAO_DELAY_JITTER   (1000UL)
 #endif
+#ifndef CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF
+/**
+ * @brief Maximum number of DAO-ACKs held back to be sent together
+ *
+ * If not 0, a DAO-ACK is not sent right away, but after
+ * @ref CONFIG_GNRC_RPL_DAO_ACK_BATCH_DELAY together with the DAO-ACKs of all
+ * DAOs received in the meantime. Repeated DAOs of the same child are only
+ * acknowledged once. By default, every DAO-ACK is sent right away.
+ */
+#define CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF    (0)
+#endif
+#ifndef CONFIG_GNRC_RPL_DAO_ACK_BATCH_DELAY
+/**
+ * @brief Delay for DAO-ACKs in milli seconds
+ *
+ * Must be well below @ref CONFIG_GNRC_RPL_DAO_ACK_DELAY of the children.
+ */
+#define CONFIG_GNRC_RPL_DAO_ACK_BATCH_DELAY    (100UL)
+#endif
 /** @} */
 
 /**
@@ -711,6 +730,11 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *instance, ipv6_addr_t *destination,
  */
 void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *instance, ipv6_addr_t *destination, uint8_t seq);
 
+/**
+ * @brief   Send all DAO-ACKs held back for @ref CONFIG_GNRC_RPL_DAO_ACK_BATCH_DELAY.
+ */
+void gnrc_rpl_send_DAO_ACK_batch(void);
+
 /**
  * @brief   Parse a DIS.
  *
@@ -13,6 +13,15 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * With module `sock_async` (e.g. via `sock_async_event`), the @ref net_sock_tcp
+ * wrapper reports connection events, so a single thread can serve many
+ * connections with non-blocking calls: gnrc_tcp_accept() and gnrc_tcp_recv()
+ * with a timeout of 0 return -EAGAIN instead of blocking. A listening queue
+ * reports SOCK_ASYNC_CONN_RECV for each established connection. An accepted
+ * connection reports SOCK_ASYNC_MSG_RECV, SOCK_ASYNC_MSG_SENT and
+ * SOCK_ASYNC_CONN_FIN once its callback is set, data that arrived before must
+ * be read right after accepting.
+ *
  * @{
  *
  * @file
@@ -177,6 +186,9 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
  * @return   -EISCONN a TCB in @p tcbs is already connected.
  * @return   -ENOMEM all available receive buffers are in use.
  *                   Increase GNRC_TCP_RCV_BUFFERS.
+ *
+ * @note SYNs arriving while all TCBs of @p queue are busy are held back (see
+ *       @ref CONFIG_GNRC_TCP_SYN_QUEUE_SIZE) until a TCB listens again.
  */
 int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
                     const gnrc_tcp_ep_t *local);
@@ -213,6 +225,14 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Data counts as transmitted once it was sent and placed in the
+ *       retransmission queue. Up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+ *       segments stay unacknowledged, so the function only blocks while the
+ *       retransmission queue is full or the send window is closed.
+ *       gnrc_tcp_close() waits until all queued data was acknowledged.
+ *       If the oldest unacknowledged segment is not acknowledged within
+ *       @ref CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS, the connection
+ *       is aborted.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -227,7 +247,8 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @return   The number of successfully transmitted bytes.
  * @return   -ENOTCONN if connection is not established.
  * @return   -ECONNRESET if connection was reset by the peer.
- * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ECONNABORTED if the connection was aborted, e.g. because sent
+ *           data was not acknowledged in time.
  * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
@@ -261,7 +282,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
  * @return   -ENOTCONN if connection is not established.
  * @return   -EAGAIN if  user_timeout_duration_us is zero and no data is available.
  * @return   -ECONNRESET if connection was reset by the peer.
- * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ECONNABORTED if the connection was aborted, e.g. because sent
+ *           data was not acknowledged in time.
  * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
  */
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
@@ -270,6 +292,10 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 /**
  * @brief Close a TCP connection.
  *
+ * Blocks until the connection is closed. A connection accepted from a
+ * listening queue is closed in the background instead, the TCB listens
+ * again once the teardown finished or timed out.
+ *
  * @pre gnrc_tcp_tcb_init() must have been successfully called.
  * @pre @p tcb must not be NULL.
  *
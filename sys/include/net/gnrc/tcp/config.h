@@ -53,6 +53,8 @@ extern "C" {
  */
 /**
  * @brief Timeout duration in milliseconds for user calls. Default is 2 minutes.
+ *
+ * A connection is also aborted if sent data stays unacknowledged this long.
  */
 #ifndef CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS
 #define CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS (120U * MS_PER_SEC)
@@ -167,6 +169,53 @@ extern "C" {
 #define CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS (60U * MS_PER_SEC)
 #endif
 
+/**
+ * @brief Number of unacknowledged segments a connection may keep in flight.
+ *
+ * @note Each queued segment stays in the packet buffer until it is
+ *       acknowledged, so the packet buffer must be able to hold this many
+ *       segments of size @ref CONFIG_GNRC_TCP_MSS per sending connection.
+ *       A value of 1 results in stop-and-wait behavior.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit. Default is 3 (see RFC 5681)
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Number of out-of-order data ranges held in the receive buffer per connection
+ *
+ * @note Segments that arrive ahead of a gap are stored in the free space of
+ *       the receive buffer and reported to the peer with SACK blocks (see
+ *       RFC 2018). Segments that would need an additional range are dropped.
+ *       A value of 0 disables out-of-order reassembly.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_RANGES
+#define CONFIG_GNRC_TCP_RCV_OOO_RANGES (4U)
+#endif
+
+/**
+ * @brief Number of connection requests held while all TCBs of a listening
+ *        queue are busy
+ *
+ * @note A SYN to a port that is listened on, but without a TCB in LISTEN
+ *       state, is held until one of the TCBs is listening again, instead of
+ *       being answered with a reset. If all places are taken, the oldest SYN
+ *       is dropped, the peer retransmits it. SYNs held longer than
+ *       @ref CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS are dropped, the
+ *       ones held when the port is not listened on anymore are answered with
+ *       a reset. A value of 0 disables holding.
+ */
+#ifndef CONFIG_GNRC_TCP_SYN_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SYN_QUEUE_SIZE (2U)
+#endif
+
 /**
  * @brief Message queue size for TCP API internal messaging
  * @note The number of elements in a message queue must be a power of two.
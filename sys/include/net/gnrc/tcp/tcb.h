@@ -19,6 +19,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -29,14 +30,30 @@
 #include "net/gnrc/pkt.h"
 #include "config.h"
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include "congure/reno.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
 
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+#include "net/sock/async/types.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Range of sequence numbers [start, end).
+ */
+typedef struct {
+    uint32_t start;   /**< First sequence number of the range */
+    uint32_t end;     /**< Sequence number following the range */
+} gnrc_tcp_seq_range_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -65,17 +82,47 @@ typedef struct sock_tcp {
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint8_t retries;       /**< Number of retransmissions of the oldest segment */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t rtt_seq;      /**< Sequence number acknowledging the timed segment */
+    uint32_t snd_recover;  /**< Highest sequence number sent on entering loss recovery */
+    uint32_t snd_rtx;      /**< Highest sequence number retransmitted during loss recovery */
+    uint32_t rtx_since;    /**< Time since the oldest unacknowledged segment waits for an ACK */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged segments, oldest first, NULL terminated
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    /**
+     * @brief Segments in pkt_retransmit that were selectively acknowledged
+     */
+    bool pkt_sacked[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+#ifdef MODULE_GNRC_TCP_CONGURE
+    congure_reno_snd_t congure;           /**< Congestion control state */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+    /**
+     * @brief Out-of-order data behind rcv_buf, most recently received first
+     */
+    gnrc_tcp_seq_range_t rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_RANGES];
+    uint8_t rcv_ooo_num;     /**< Number of ranges in rcv_ooo */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
+    struct sock_tcp_queue *queue; /**< Listening queue of the TCB, NULL if not listening */
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    sock_tcp_cb_t async_cb;  /**< Asynchronous event callback */
+    void *async_cb_arg;      /**< Argument of async_cb */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx; /**< Asynchronous event context */
+#endif
+#endif
 } gnrc_tcp_tcb_t;
 
 /**
@@ -85,12 +132,19 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    sock_tcp_queue_cb_t async_cb; /**< Asynchronous event callback */
+    void *async_cb_arg;           /**< Argument of async_cb */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx;   /**< Asynchronous event context */
+#endif
+#endif
 } gnrc_tcp_tcb_queue_t;
 
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { .lock = MUTEX_INIT, .tcbs = NULL, .tcbs_len = 0 }
 
 #ifdef __cplusplus
 }
@@ -339,6 +339,21 @@ typedef const struct {
     const size_t resources_numof;       /**< number of entries in array */
 } coap_resource_subtree_t;
 
+/**
+ * @brief   Pre-serialized response of a static resource
+ *
+ * See coap_static_response_init() and @ref COAP_STATIC_RESOURCE.
+ */
+typedef struct {
+    const uint8_t *opts;            /**< encoded options, followed by the
+                                     *   payload marker and payload, if any */
+    const uint8_t *etag;            /**< value of the ETag option, if any */
+    uint16_t opts_len;              /**< length of the options only */
+    uint16_t len;                   /**< length of options and payload */
+    uint8_t etag_len;               /**< length of @ref etag */
+    uint8_t code;                   /**< response code */
+} coap_static_response_t;
+
 /**
  * @brief   Initialize CoAP request context
  *
@@ -2540,6 +2555,79 @@ ssize_t coap_reply_simple(coap_pkt_t *pkt,
                           uint16_t ct,
                           const void *payload, size_t payload_len);
 
+/**
+ * @brief   Pre-serializes the response of a static resource
+ *
+ * For resources that change rarely if at all, such as `/.well-known/core` or
+ * device information, the response can be encoded once. Build it in @p pkt
+ * as usual, starting with a header without token:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static uint8_t buf[64];
+ * static coap_static_response_t resp;
+ * coap_pkt_t pkt;
+ *
+ * size_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_NON, NULL, 0,
+ *                                 COAP_CODE_CONTENT, 0);
+ * coap_pkt_init(&pkt, buf, sizeof(buf), len);
+ * coap_opt_add_opaque(&pkt, COAP_OPT_ETAG, &etag, sizeof(etag));
+ * coap_opt_add_format(&pkt, COAP_FORMAT_TEXT);
+ * len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+ * memcpy(pkt.payload, "hello", 5);
+ * coap_static_response_init(&resp, &pkt, len + 5);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Requests to the resource are then answered by
+ * coap_static_response_handler(), which only writes the header with the
+ * message ID and token of the request and copies the options and payload.
+ * If the response has an ETag and the request carries a matching one, a
+ * 2.03 (Valid) response with the options only is sent instead.
+ *
+ * The buffer of @p pkt must stay valid while @p resp is in use. To update the
+ * response, build it in a second buffer and call this function again.
+ *
+ * @param[out]  resp        the pre-serialized response
+ * @param[in]   pkt         the response to serialize
+ * @param[in]   len         length of the response in @p pkt, including payload
+ *
+ * @retval      0           on success
+ * @retval      -EINVAL     @p pkt has a token or @p len is out of range
+ */
+int coap_static_response_init(coap_static_response_t *resp,
+                              const coap_pkt_t *pkt, size_t len);
+
+/**
+ * @brief   Resource handler sending a pre-serialized response
+ *
+ * The resource context must point to a @ref coap_static_response_t set up
+ * by coap_static_response_init(), see @ref COAP_STATIC_RESOURCE.
+ *
+ * @param[in]   pkt         the request
+ * @param[out]  buf         buffer to write the response to
+ * @param[in]   len         size of @p buf
+ * @param[in]   context     request context
+ *
+ * @returns     size of the response on success
+ * @retval      -ECANCELED  reply should not be sent due to no-reply option
+ * @retval      -ENOBUFS    @p buf too small
+ */
+ssize_t coap_static_response_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                                     coap_request_ctx_t *context);
+
+/**
+ * @brief   Resource definition for a resource with a pre-serialized response
+ *
+ * @param[in]   res_path    path of the resource
+ * @param[in]   resp        pointer to the @ref coap_static_response_t
+ */
+#define COAP_STATIC_RESOURCE(res_path, resp) \
+    { \
+        .path = res_path, \
+        .methods = COAP_GET, \
+        .handler = coap_static_response_handler, \
+        .context = resp \
+    }
+
 /**
  * @brief   Reference to the default .well-known/core handler defined by the
  *          application
@@ -13,6 +13,21 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Entries are found through a hash table indexed by the cache key, so a
+ * lookup does not need to compare the key of every cached response. The
+ * responses are stored back to back in a shared arena of
+ * @ref CONFIG_NANOCOAP_CACHE_ARENA_SIZE bytes, so small responses don't take
+ * up a buffer sized for the largest cacheable response. When an entry is
+ * removed, the responses stored after it are moved down to keep the arena
+ * free of holes. If an entry or arena space is needed but not available, the
+ * least recently used entries are evicted.
+ *
+ * By default, cache keys are SHA-256 digests. With
+ * @ref CONFIG_NANOCOAP_CACHE_KEY_FNV, the much cheaper 64-bit FNV-1a hash is
+ * used instead. This is only suitable if requests cannot be crafted to
+ * collide with the cached responses of others, e.g. if the cache is not used
+ * for a forward proxy accessible to untrusted clients.
+ *
  * @{
  *
  * @file
@@ -48,21 +63,52 @@ extern "C" {
 #endif
 
 /**
- * @brief Size of the buffer to store responses in the cache.
+ * @brief Maximum size of a response stored in the cache.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief Size of the arena shared by all cached responses in bytes.
+ *
+ * Must be at least @ref CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_ARENA_SIZE
+#define CONFIG_NANOCOAP_CACHE_ARENA_SIZE \
+    (CONFIG_NANOCOAP_CACHE_ENTRIES * CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
+#endif
+
+/**
+ * @brief Number of buckets of the hash table over the cache keys.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (CONFIG_NANOCOAP_CACHE_ENTRIES)
+#endif
+
+/**
+ * @brief Use 64-bit FNV-1a instead of SHA-256 to generate cache keys.
+ *
+ * Requires @ref CONFIG_NANOCOAP_CACHE_KEY_LENGTH to be 8 bytes at most.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_KEY_FNV
+#define CONFIG_NANOCOAP_CACHE_KEY_FNV          0
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
-typedef struct {
+typedef struct nanocoap_cache_entry {
     /**
      * @brief needed for clist_t, must be the first struct member!
      */
     clist_node_t node;
 
+    /**
+     * @brief next entry in the same bucket of the cache key hash table
+     */
+    struct nanocoap_cache_entry *bucket_next;
+
     /**
      * @brief the calculated cache key, see nanocoap_cache_key_generate().
      */
@@ -74,9 +120,12 @@ typedef struct {
     coap_pkt_t response_pkt;
 
     /**
-     * @brief buffer to hold the response message.
+     * @brief the response message, located in the cache arena.
+     *
+     * @warning Only valid until the cache is modified, as removing an entry
+     *          moves the responses of other entries.
      */
-    uint8_t response_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+    uint8_t *response_buf;
 
     size_t response_len; /**< length of the message in @p response */
 
@@ -92,6 +141,15 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics, see nanocoap_cache_get_stats()
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries removed to make room */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -136,6 +194,22 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Returns the number of bytes used in the response arena.
+ *
+ * @return  Number of bytes occupied by cached responses
+ */
+size_t nanocoap_cache_arena_used(void);
+
+/**
+ * @brief   Gets the cache statistics.
+ *
+ * The counters are reset by nanocoap_cache_init().
+ *
+ * @param[out] stats        The statistics
+ */
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
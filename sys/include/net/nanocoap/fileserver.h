@@ -41,6 +41,13 @@
  * not become aware of the change or may even mix up the versions half way
  * through if they have a part of the old version cached.
  *
+ * With @ref CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE, the ETag and size of
+ * recently requested files are kept per path, so validation requests
+ * (ETag, If-Match, If-None-Match) and the block requests of a GET are answered
+ * without a stat of the file. The entries are updated on PUT and DELETE
+ * requests through the file server. If the application modifies served files
+ * by other means, it must call @ref nanocoap_fileserver_invalidate afterwards.
+ *
  * # Usage
  *
  * * ``USEMODULE += nanocoap_fileserver``
@@ -83,6 +90,42 @@ extern "C" {
 
 #include "net/nanocoap.h"
 
+/**
+ * @brief   Size of the read-ahead buffer of the file server in bytes
+ *
+ * Between the block requests of a GET, the file server keeps the file open, so
+ * sequential blocks are read without opening the file and seeking again. With
+ * read-ahead, blocks are served from a buffer that is refilled by a single
+ * read whenever a requested block is not in it. This helps with file systems
+ * where small reads are expensive and with clients keeping multiple block
+ * requests in flight (see @ref nanocoap_sock_get_blockwise_window()), whose
+ * requests may arrive out of order. 0 disables read-ahead.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_READ_AHEAD
+#define CONFIG_NANOCOAP_FILESERVER_READ_AHEAD   (0)
+#endif
+
+/**
+ * @brief   Number of files the file server keeps open between block requests
+ *
+ * Every client gets its own file handle, so clients downloading different
+ * files at the same time do not close each other's files. Each one takes a
+ * file descriptor of the VFS and its own read-ahead buffer.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_OPEN_FILES
+#define CONFIG_NANOCOAP_FILESERVER_OPEN_FILES   (1)
+#endif
+
+/**
+ * @brief   Number of files whose ETag and size are cached by the file server
+ *
+ * 0 disables the cache, see @ref net_nanocoap_fileserver for when the entries
+ * need to be invalidated.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE
+#define CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE   (0)
+#endif
+
 /**
  * @brief   Randomly generated Etag, used by a client when a directory should only be
  *          deleted, if it is empty
@@ -134,6 +177,25 @@ typedef void (*nanocoap_fileserver_event_handler_t)(nanocoap_fileserver_event_t
  */
 void nanocoap_fileserver_set_event_cb(nanocoap_fileserver_event_handler_t cb, void *arg);
 
+/**
+ * @brief   Closes the files kept open between the block requests of a GET
+ *
+ * A file is closed after its last block was served or when its slot is needed
+ * for another file. A client abandoning a transfer leaves the file open until
+ * then, so call this e.g. before unmounting the file system.
+ */
+void nanocoap_fileserver_release_files(void);
+
+/**
+ * @brief   Tells the file server that a file was modified by other means
+ *
+ * Closes the file if it is kept open and drops its cached ETag.
+ *
+ * @param[in] path  VFS path of the modified file, for a directory all files
+ *                  below it are affected, NULL for all files
+ */
+void nanocoap_fileserver_invalidate(const char *path);
+
 /**
  * @brief File server handler
  *
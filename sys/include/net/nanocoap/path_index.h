@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_nanocoap_path_index nanoCoAP resource path index
+ * @ingroup     net_nanocoap
+ * @brief       Hash index for dispatching requests to resources
+ *
+ * Without this module, a request is dispatched by copying its Uri-Path
+ * options into a string and comparing that to the path of every resource in
+ * turn. With many resources, this string-compare loop dominates the request
+ * handling.
+ *
+ * The module `nanocoap_path_index` builds a hash table over the paths of an
+ * array of resources once. A request is then hashed while walking its
+ * Uri-Path options, and only the resources found in the table are compared,
+ * again directly against the options without copying them. Resources matching
+ * a subtree (@ref COAP_MATCH_SUBTREE) are indexed by their path prefix, which
+ * is looked up only at the prefix lengths actually in use.
+ *
+ * The result is the same as for the linear search: the first resource in the
+ * array that matches path and method. If enabled, both the nanoCoAP server
+ * (for the `nanocoap_resources` XFA) and gcoap (for every registered listener
+ * using the default request matcher) use the index. If the index is out of
+ * space, they fall back to the linear search.
+ *
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource path index interface
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_nanocoap_path_index_conf   nanoCoAP path index compile configurations
+ * @ingroup  net_nanocoap_conf
+ * @{
+ */
+/**
+ * @brief   Number of index slots for the resources of the nanoCoAP server
+ *
+ * Must be a power of two. The index is only used if the resources take up
+ * at most 3/4 of the slots.
+ */
+#ifndef CONFIG_NANOCOAP_PATH_INDEX_SLOTS
+#define CONFIG_NANOCOAP_PATH_INDEX_SLOTS    (64U)
+#endif
+/** @} */
+
+/**
+ * @brief   Maximum number of resources in an index
+ */
+#define COAP_PATH_INDEX_RESOURCES_MAX       (0x7fffU)
+
+/**
+ * @brief   Resource path index
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< indexed resources */
+    uint32_t *slots;                    /**< hash table */
+    uint32_t subtree_lens;              /**< bit n set: a subtree resource has
+                                         *   a path of n bytes, bit 31 for
+                                         *   paths of 31 bytes or more */
+    uint16_t mask;                      /**< number of slots - 1 */
+} coap_path_index_t;
+
+/**
+ * @brief   Builds the index for an array of resources
+ *
+ * @param[out] index        Index to initialize
+ * @param[in] resources     Resources to index, must stay in place while the
+ *                          index is used
+ * @param[in] resources_numof   Number of elements in @p resources
+ * @param[in] slots         Storage for the hash table
+ * @param[in] slots_numof   Number of elements in @p slots, must be a power of
+ *                          two
+ *
+ * @return  0 on success
+ * @return  -ENOSPC if @p resources take up more than 3/4 of @p slots
+ */
+int coap_path_index_init(coap_path_index_t *index,
+                         const coap_resource_t *resources,
+                         size_t resources_numof,
+                         uint32_t *slots, size_t slots_numof);
+
+/**
+ * @brief   Finds the first resource matching the Uri-Path and method of a
+ *          request
+ *
+ * @param[in] index         Index to search
+ * @param[in] pkt           The request
+ * @param[in] method        Method flag of the request, see coap_method2flag()
+ * @param[out] resource     The matching resource
+ *
+ * @return  0 if a resource was found
+ * @return  -EPERM if resources match the path, but not the method
+ * @return  -ENOENT if no resource matches the path
+ * @return  -EBADMSG if the Uri-Path does not fit into
+ *          @ref CONFIG_NANOCOAP_URI_MAX bytes, like for coap_get_uri_path()
+ */
+int coap_path_index_find(const coap_path_index_t *index, coap_pkt_t *pkt,
+                         coap_method_flags_t method,
+                         const coap_resource_t **resource);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -189,6 +189,14 @@ extern "C" {
 #define CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN        (0)
 #endif
 
+/**
+ * @brief   Maximum number of blocks a windowed block-wise transfer keeps in
+ *          flight, see @ref nanocoap_sock_get_blockwise_window()
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+#define CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX   (8)
+#endif
+
 /**
  * @brief   Event priority for nanoCoAP sock events (e.g. used by `nanocoap_sock_observe`)
  */
@@ -850,6 +858,46 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request on a socket, keeping
+ *           multiple block requests in flight.
+ *
+ * Like @ref nanocoap_sock_get_blockwise(), but instead of waiting a round-trip
+ * for every block, up to a window of blocks is requested at once. The first
+ * block is fetched alone to learn the block size chosen by the server and,
+ * if the server sends a Size2 option, the total size. Then the window opens
+ * by one block for every window of blocks received and is halved whenever a
+ * request has to be retransmitted.
+ *
+ * Blocks arriving out of order are kept in @p buf, so @p callback is still
+ * called once per block in order. The window is limited to one block more
+ * than fit into @p buf and to @ref CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX.
+ *
+ * @note    Every block is requested with its own token, so this ignores
+ *          @ref CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN.
+ *
+ * @note    Only downloads are windowed. Uploads with
+ *          nanocoap_sock_block_request() still wait for the response to
+ *          every Block1 request before sending the next one.
+ *
+ * @param[in]   sock       socket to use for the request
+ * @param[in]   path       pointer to source path
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   buf        buffer for blocks received out of order
+ * @param[in]   len        length of @p buf, `0` fetches one block at a time
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns      0         on success
+ * @returns     -ETIMEDOUT if a block request was not answered
+ * @returns     <0         on other errors, or the error returned by
+ *                         @p callback
+ */
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize,
+                                       void *buf, size_t len,
+                                       coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
@@ -890,6 +938,29 @@ int nanocoap_get_blockwise_url(const char *url,
                                coap_blksize_t blksize,
                                coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request to the specified url,
+ *           keeping multiple block requests in flight.
+ *
+ * See @ref nanocoap_sock_get_blockwise_window() for details.
+ *
+ * @param[in]   url        Absolute URL pointer to source path (i.e. not containing
+ *                         a fragment identifier)
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   buf        buffer for blocks received out of order
+ * @param[in]   len        length of @p buf
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns     -EINVAL    if an invalid url is provided
+ * @returns     <0         if failed to fetch the url content
+ * @returns      0         on success
+ */
+int nanocoap_get_blockwise_window_url(const char *url,
+                                      coap_blksize_t blksize,
+                                      void *buf, size_t len,
+                                      coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
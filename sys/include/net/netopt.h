@@ -877,6 +877,22 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (uint8_t) number of frames the device accepts for transmission
+     *          at the same time
+     *
+     * Only meaningful for devices implementing netdev_driver_t::confirm_send.
+     * Such a device accepts further calls of netdev_driver_t::send before the
+     * first frame was confirmed, e.g. because it has several transmit
+     * descriptors. netdev_driver_t::confirm_send reports the frames in the
+     * order they were sent and returns `-EAGAIN` while the oldest one is still
+     * ongoing. A single NETDEV_EVENT_TX_COMPLETE may be signaled for several
+     * completed frames.
+     *
+     * Devices without this option accept only one frame at a time.
+     */
+    NETOPT_TX_QUEUE_LEN,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -50,6 +50,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_PKTQ       (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -69,6 +70,16 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Statistics of a packet queue (of one class of packets)
+ */
+typedef struct {
+    uint32_t enqueued;          /**< packets put into the queue */
+    uint32_t dropped;           /**< packets dropped, as the queue was full */
+    uint16_t len;               /**< packets currently in the queue */
+    uint16_t len_max;           /**< maximum of netstats_pktq_t::len */
+} netstats_pktq_t;
+
 /**
  * @brief       Stats per peer struct
  */
@@ -90,6 +90,8 @@ extern "C" {
  * @return      -ECONNREFUSED, when a DNS over DTLS server  is not configured.
  * @return      -ENOSPC, when the length of @p domain_name is greater than @ref
  *              SOCK_DODTLS_MAX_NAME_LEN.
+ * @return      -ENOENT, when the server stated that @p domain_name has no
+ *              address of @p family.
  * @return      -EBADSG, when the DNS reply is not parseable.
  */
 int sock_dodtls_query(const char *domain_name, void *addr_out, int family);
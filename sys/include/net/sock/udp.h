@@ -375,6 +375,22 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   Description of a single datagram for @ref sock_udp_sendmmsg()
+ */
+typedef struct {
+    const iolist_t *snips;          /**< payload chunks of the datagram,
+                                     *   may be `NULL` */
+    const sock_udp_ep_t *remote;    /**< remote end point of the datagram,
+                                     *   may be `NULL` if the sock has a
+                                     *   remote end point */
+    sock_udp_aux_tx_t *aux;         /**< auxiliary data for the datagram,
+                                     *   may be `NULL`, see
+                                     *   @ref sock_udp_sendv_aux() */
+    ssize_t res;                    /**< [out] result of sending the datagram,
+                                     *   see @ref sock_udp_sendv_aux() */
+} sock_udp_mmsg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -799,6 +815,36 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Sends multiple UDP messages in one go
+ *
+ * Behaves like calling @ref sock_udp_sendv() for every element of @p msgs,
+ * but allows the implementation to hand all datagrams to the network stack
+ * at once and to reuse source address selection and route lookup for
+ * consecutive datagrams to the same remote end point. Datagrams are sent in
+ * order, processing stops at the first datagram that fails.
+ *
+ * @note    Implementations may only wait for the transmission of the last
+ *          datagram of the batch (e.g. with `gnrc_tx_sync`) and may only
+ *          report errors of the stack for it.
+ *
+ * @pre `((sock != NULL || all msgs[i].remote != NULL)) && (msgs != NULL || num == 0)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in,out] msgs  Datagrams to send. sock_udp_mmsg_t::res is set for
+ *                      every datagram that was attempted to be sent.
+ * @param[in] num       Number of elements in @p msgs.
+ *
+ * @return  The number of datagrams sent on success. If less than @p num,
+ *          sock_udp_mmsg_t::res of the first datagram not sent holds the
+ *          error (see @ref sock_udp_sendv_aux()).
+ * @return  Negative errno as @ref sock_udp_sendv_aux() if not even the first
+ *          datagram could be sent.
+ */
+int sock_udp_sendmmsg(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
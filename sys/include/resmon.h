@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_resmon Resource monitor
+ * @ingroup     sys
+ * @brief       Periodic sampling of CPU load and stack usage
+ *
+ * The module `resmon` samples the CPU load of every thread, the time spent in
+ * ISRs and the stack high-water marks in the background, so the resource
+ * headroom of a node can be watched without stopping it to run shell commands.
+ *
+ * Sampling
+ * ========
+ *
+ * Every @ref CONFIG_RESMON_PERIOD_MS milliseconds a sample is taken on the
+ * lowest priority queue of @ref sys_event_thread. The CPU load is derived from
+ * the runtime tracked by @ref schedstatistics and averaged over
+ * a short, a medium and a long window (@ref CONFIG_RESMON_WINDOW_SHORT and
+ * friends), similar to the load average of UNIX systems.
+ *
+ * Instead of scanning the whole stack of every thread for the canary pattern
+ * on every sample as `ps` does, at most @ref CONFIG_RESMON_STACK_SCAN_WORDS
+ * words per thread and sample are checked. These first follow the used words
+ * down from the last high-water mark, then continue a background pass up from
+ * the bottom of the stack that catches words skipped by the stack growth. So
+ * the cost of a sample is bounded, while the mark converges within a few
+ * periods. Stack usage is only known with `DEVELHELP`, as otherwise the size
+ * of the stacks is not recorded.
+ *
+ * Time spent in ISRs is not accounted separately, as there is no common
+ * entry point to interrupt handlers on all platforms. It shows up in the load
+ * of the thread that was interrupted.
+ *
+ * Export
+ * ======
+ *
+ * After every sample a compact binary record is passed to the callback
+ * registered with resmon_set_export_cb(). resmon_export_stdio() writes the
+ * record to stdio, the module `resmon_udp` sends it to a remote UDP endpoint
+ * using resmon_udp_init(). All fields are in network byte order:
+ *
+ * | Offset        | Size | Field                                           |
+ * |---------------|------|-------------------------------------------------|
+ * | 0             | 1    | @ref RESMON_RECORD_MAGIC                        |
+ * | 1             | 1    | @ref RESMON_RECORD_VERSION                      |
+ * | 2             | 2    | sequence number                                 |
+ * | 4             | 4    | time of the sample in ms                        |
+ * | 8             | 1    | number of threads `n`                           |
+ * | 9             | 1    | number of windows `w`                           |
+ * | 10            | 2    | ISR stack used in bytes                         |
+ * | 12            | ...  | `n` thread entries of `5 + 2w` bytes each       |
+ *
+ * A thread entry consists of the PID (1 byte), the load per window (2 bytes
+ * each, per mille), the stack size and the stack high-water mark (2 bytes
+ * each). Without `core_idle_thread`, PID 0 reports the idle time.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Resource monitor interface
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "modules.h"
+#include "sched.h"
+#if IS_USED(MODULE_RESMON_UDP)
+#include "net/sock/udp.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_resmon_config  Resource monitor compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Sampling period in milliseconds
+ */
+#ifndef CONFIG_RESMON_PERIOD_MS
+#define CONFIG_RESMON_PERIOD_MS         (1000U)
+#endif
+
+/**
+ * @brief   Length of the short load averaging window in samples
+ */
+#ifndef CONFIG_RESMON_WINDOW_SHORT
+#define CONFIG_RESMON_WINDOW_SHORT      (1U)
+#endif
+
+/**
+ * @brief   Length of the medium load averaging window in samples
+ */
+#ifndef CONFIG_RESMON_WINDOW_MEDIUM
+#define CONFIG_RESMON_WINDOW_MEDIUM     (10U)
+#endif
+
+/**
+ * @brief   Length of the long load averaging window in samples
+ */
+#ifndef CONFIG_RESMON_WINDOW_LONG
+#define CONFIG_RESMON_WINDOW_LONG       (60U)
+#endif
+
+/**
+ * @brief   Maximum number of stack words checked per thread and sample
+ */
+#ifndef CONFIG_RESMON_STACK_SCAN_WORDS
+#define CONFIG_RESMON_STACK_SCAN_WORDS  (64U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of load averaging windows
+ */
+#define RESMON_WINDOW_NUMOF     (3U)
+
+/**
+ * @brief   First byte of every exported record
+ */
+#define RESMON_RECORD_MAGIC     (0x52)
+
+/**
+ * @brief   Version of the record format
+ */
+#define RESMON_RECORD_VERSION   (1U)
+
+/**
+ * @brief   Size of a record reporting @p threads threads
+ */
+#define RESMON_RECORD_SIZE(threads) \
+    (12 + ((threads) * (5 + (2 * RESMON_WINDOW_NUMOF))))
+
+/**
+ * @brief   Callback for exporting a record
+ *
+ * @param[in] record    The record
+ * @param[in] len       Length of @p record in bytes
+ * @param[in] arg       Argument registered with the callback
+ */
+typedef void (*resmon_export_cb_t)(const void *record, size_t len, void *arg);
+
+/**
+ * @brief   Starts periodic sampling
+ *
+ * @note    Called by auto_init, unless `auto_init_resmon` is disabled.
+ */
+void resmon_init(void);
+
+/**
+ * @brief   Takes a sample right away and exports it
+ *
+ * @note    Sampling is not thread-safe, this is meant to be used with
+ *          `auto_init_resmon` disabled.
+ */
+void resmon_sample(void);
+
+/**
+ * @brief   Sets the callback records are exported to
+ *
+ * @param[in] cb        The callback, NULL to disable exporting
+ * @param[in] arg       Argument passed to @p cb
+ */
+void resmon_set_export_cb(resmon_export_cb_t cb, void *arg);
+
+/**
+ * @brief   Export callback writing the record to stdio
+ *
+ * @param[in] record    The record
+ * @param[in] len       Length of @p record in bytes
+ * @param[in] arg       Ignored
+ */
+void resmon_export_stdio(const void *record, size_t len, void *arg);
+
+/**
+ * @brief   Writes a record of the last sample to a buffer
+ *
+ * @param[out] buf      Buffer to write the record to
+ * @param[in] len       Length of @p buf
+ *
+ * @return  length of the record
+ * @return  -ENOBUFS if @p buf is too small
+ */
+ssize_t resmon_get_record(void *buf, size_t len);
+
+/**
+ * @brief   Returns the CPU load of a thread
+ *
+ * @param[in] pid       PID of the thread, KERNEL_PID_UNDEF for idle time
+ *                      without `core_idle_thread`
+ * @param[in] window    Index of the averaging window, 0 (short) to
+ *                      @ref RESMON_WINDOW_NUMOF - 1 (long)
+ *
+ * @return  load in per mille
+ */
+unsigned resmon_load(kernel_pid_t pid, unsigned window);
+
+/**
+ * @brief   Returns the stack high-water mark of a thread
+ *
+ * @param[in] pid       PID of the thread
+ *
+ * @return  number of stack bytes used so far, 0 if unknown
+ */
+size_t resmon_stack_used(kernel_pid_t pid);
+
+#if IS_USED(MODULE_RESMON_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Exports the records to a UDP endpoint
+ *
+ * @note    Only available with module `resmon_udp`.
+ *
+ * @param[in] remote    Endpoint to send the records to
+ *
+ * @return  0 on success
+ * @return  negative errno on error, see sock_udp_create()
+ */
+int resmon_udp_init(const sock_udp_ep_t *remote);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
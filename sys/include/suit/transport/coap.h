@@ -53,6 +53,16 @@ extern "C" {
 #define CONFIG_SUIT_COAP_BLOCKSIZE  CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT
 #endif
 
+/**
+ * @brief Number of blocks kept in flight while fetching a payload
+ *
+ * Values larger than 1 use nanocoap_get_blockwise_window_url(), with a
+ * buffer of `CONFIG_SUIT_COAP_BLOCK_WINDOW - 1` blocks.
+ */
+#ifndef CONFIG_SUIT_COAP_BLOCK_WINDOW
+#define CONFIG_SUIT_COAP_BLOCK_WINDOW   (1)
+#endif
+
 /**
  * @brief   Trigger a SUIT udate
  *
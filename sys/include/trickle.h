@@ -18,6 +18,19 @@
  *
  * @see https://tools.ietf.org/html/rfc6206
  *
+ * With the `trickle_stats` module, every trickle timer counts its
+ * transmissions, suppressions and resets in trickle_t::stats, so the control
+ * overhead of a protocol using trickle can be weighed against its convergence
+ * time.
+ *
+ * With the `trickle_adaptive` module, the redundancy constant k is scaled
+ * down in dense neighborhoods: each timer estimates the number of neighbors
+ * from the consistent messages heard per interval and the share of intervals
+ * it transmitted in itself. If more than @ref CONFIG_TRICKLE_ADAPTIVE_DENSITY
+ * neighbors are estimated, only
+ * `k * CONFIG_TRICKLE_ADAPTIVE_DENSITY / neighbors` (at least 1) consistent
+ * messages suppress a transmission. See trickle_get_k().
+ *
  * @{
  *
  * @file
@@ -31,9 +44,31 @@
  extern "C" {
 #endif
 
+#include "modules.h"
 #include "thread.h"
 #include "ztimer.h"
 
+/**
+ * @brief   Number of neighbors the redundancy constant is meant for
+ *
+ * Only used with the `trickle_adaptive` module.
+ */
+#ifndef CONFIG_TRICKLE_ADAPTIVE_DENSITY
+#define CONFIG_TRICKLE_ADAPTIVE_DENSITY (4U)
+#endif
+
+/**
+ * @brief Counters of a trickle timer
+ *
+ * Only available with the `trickle_stats` module.
+ */
+typedef struct {
+    uint32_t tx;                /**< intervals the callback was called in */
+    uint32_t suppressed;        /**< intervals the callback was suppressed in */
+    uint32_t heard;             /**< consistent messages counted */
+    uint32_t resets;            /**< resets to the minimum interval */
+} trickle_stats_t;
+
 /**
  * @brief Trickle callback function with arguments
  */
@@ -60,6 +95,15 @@ typedef struct {
     msg_t msg;                      /**< the msg_t to use for intervals */
     ztimer_t msg_timer;             /**< timer to send a msg_t to the target
                                          thread for a new interval */
+#if IS_USED(MODULE_TRICKLE_ADAPTIVE) || defined(DOXYGEN)
+    uint16_t heard_avg;             /**< average of c per interval,
+                                         in 1/16 */
+    uint16_t tx_avg;                /**< share of intervals with a
+                                         transmission, in 1/256 */
+#endif
+#if IS_USED(MODULE_TRICKLE_STATS) || defined(DOXYGEN)
+    trickle_stats_t stats;          /**< counters */
+#endif
 } trickle_t;
 
 /**
@@ -75,6 +119,8 @@ void trickle_reset_timer(trickle_t *trickle);
 /**
  * @brief start the trickle timer
  *
+ * Clears trickle_t::stats, if available.
+ *
  * @pre `Imin > 0`
  * @pre `(Imin << Imax) < (UINT32_MAX / 2)` to avoid overflow of uint32_t
  *
@@ -111,6 +157,18 @@ void trickle_increment_counter(trickle_t *trickle);
  */
 void trickle_interval(trickle_t *trickle);
 
+/**
+ * @brief returns the redundancy constant currently in effect
+ *
+ * This is trickle_t::k, unless the `trickle_adaptive` module scaled it down
+ * for a dense neighborhood.
+ *
+ * @param[in] trickle   trickle timer
+ *
+ * @return  the redundancy constant, 0 for infinity
+ */
+uint8_t trickle_get_k(const trickle_t *trickle);
+
 /**
  * @brief is called after the interval is over and executes callback function
  *
@@ -460,6 +460,34 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to fire up to @p slack ticks
+ *          late
+ *
+ * Use this for timers that do not need to be precise, e.g. periodic
+ * housekeeping or retransmissions. Instead of waking up separately, the timer
+ * is aligned to a timer already set on @p clock within
+ * [@p val, @p val + @p slack]. If there is none, the target is rounded up to
+ * the coarsest power of two not exceeding @p slack, so that timers set
+ * independently of each other end up on the same ticks and get handled in a
+ * single interrupt.
+ *
+ * Only timers of the same clock are coalesced.
+ *
+ * @note The memory pointed to by @p timer is not copied and must
+ *       remain in scope until the callback is fired or the timer
+ *       is removed via @ref ztimer_remove
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         earliest timer target (relative ticks from now)
+ * @param[in]   slack       number of ticks the timer may fire late
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -15,8 +15,10 @@
  * @}
  */
 
-#include "bitfield.h"
-#include "checksum/fletcher32.h"
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
 #include "mutex.h"
 #include "net/af.h"
 #include "net/dns/cache.h"
@@ -28,9 +30,30 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* entries are linked by their index + 1, so 0 terminates a bucket chain */
+#define NIL             (0U)
+
+/* FNV-1a */
+#define HASH_BASIS      (14695981039346656037ULL)
+#define HASH_PRIME      (1099511628211ULL)
+
+#define STORE_NAMES     (CONFIG_DNS_CACHE_NAME_LEN > 0)
+
+static_assert(CONFIG_DNS_CACHE_SIZE < UINT8_MAX,
+              "CONFIG_DNS_CACHE_SIZE must be less than 255");
+static_assert(CONFIG_DNS_CACHE_BUCKETS > 0,
+              "CONFIG_DNS_CACHE_BUCKETS must not be 0");
+
 static struct dns_cache_entry {
-    uint32_t hash;
+    uint64_t hash;
     uint32_t expires;
+    uint8_t next;       /* next entry in the same bucket */
+    uint8_t heap_pos;   /* position in _heap */
+    uint8_t len;        /* address length, 0 for a negative AF_UNSPEC entry */
+    bool negative;
+#if STORE_NAMES
+    char name[CONFIG_DNS_CACHE_NAME_LEN];
+#endif
     union {
 #if IS_ACTIVE(CONFIG_DNS_CACHE_A)
         ipv4_addr_t v4;
@@ -42,106 +65,177 @@ static struct dns_cache_entry {
 } cache[CONFIG_DNS_CACHE_SIZE];
 static mutex_t cache_mutex = MUTEX_INIT;
 
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-BITFIELD(cache_is_v6, CONFIG_DNS_CACHE_SIZE);
+/* the first _used elements are a min-heap of the entries in use, ordered by
+ * their expiry, the remaining elements are the free entries */
+static uint8_t _heap[CONFIG_DNS_CACHE_SIZE];
+static uint8_t _used;
+static uint8_t _buckets[CONFIG_DNS_CACHE_BUCKETS];
+static bool _initialized;
 
-static inline uint8_t _get_len(unsigned idx)
+static uint8_t _addr_len(int family)
 {
-    return bf_isset(cache_is_v6, idx) ? 16 : 4;
+    switch (family) {
+#if IS_ACTIVE(CONFIG_DNS_CACHE_A)
+    case AF_INET:
+        return sizeof(ipv4_addr_t);
+#endif
+#if IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
+    case AF_INET6:
+        return sizeof(ipv6_addr_t);
+#endif
+    case AF_UNSPEC:
+        return 0;
+    default:
+        return 255;
+    }
 }
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_A)
-static inline uint8_t _get_len(unsigned idx)
+
+static uint32_t _now(void)
 {
-    (void)idx;
-    return 4;
+    return ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
 }
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-static inline uint8_t _get_len(unsigned idx)
+
+static inline bool _before(uint32_t a, uint32_t b)
 {
-    (void)idx;
-    return 16;
+    return (int32_t)(a - b) < 0;
 }
+
+static bool _name_fits(const char *domain_name)
+{
+#if STORE_NAMES
+    return strlen(domain_name) < CONFIG_DNS_CACHE_NAME_LEN;
+#else
+    (void)domain_name;
+    return true;
 #endif
+}
 
-static void _set_len(unsigned idx, uint8_t len)
+static uint64_t _hash(const char *domain_name)
 {
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-    if (len == 16) {
-        bf_set(cache_is_v6, idx);
-    } else {
-        bf_unset(cache_is_v6, idx);
+    uint64_t hash = HASH_BASIS;
+
+    while (*domain_name) {
+        hash = (hash ^ (uint8_t)*domain_name++) * HASH_PRIME;
     }
+    return hash;
+}
+
+static bool _matches(unsigned idx, uint64_t hash, const char *domain_name)
+{
+    if (cache[idx].hash != hash) {
+        return false;
+    }
+#if STORE_NAMES
+    return strcmp(cache[idx].name, domain_name) == 0;
 #else
-    (void)idx;
-    (void)len;
+    (void)domain_name;
+    return true;
 #endif
 }
 
-static bool _is_empty(unsigned idx)
+static uint8_t *_bucket(uint64_t hash)
+{
+    return &_buckets[hash % CONFIG_DNS_CACHE_BUCKETS];
+}
+
+static void _heap_set(unsigned pos, uint8_t idx)
 {
-    const uint8_t len = _get_len(idx);
-    const uint8_t *addr = (void *)&cache[idx].addr;
-    for (unsigned i = 0; i < len; ++i) {
-        if (addr[i]) {
-            return false;
+    _heap[pos] = idx;
+    cache[idx].heap_pos = pos;
+}
+
+static void _sift_up(unsigned pos)
+{
+    uint8_t idx = _heap[pos];
+
+    while (pos > 0) {
+        unsigned parent = (pos - 1) / 2;
+        if (!_before(cache[idx].expires, cache[_heap[parent]].expires)) {
+            break;
         }
+        _heap_set(pos, _heap[parent]);
+        pos = parent;
     }
-
-    return true;
+    _heap_set(pos, idx);
 }
 
-static void _set_empty(unsigned idx)
+static void _sift_down(unsigned pos)
 {
-    memset(&cache[idx].addr, 0, _get_len(idx));
+    uint8_t idx = _heap[pos];
+
+    for (unsigned child; (child = 2 * pos + 1) < _used; pos = child) {
+        if ((child + 1 < _used) &&
+            _before(cache[_heap[child + 1]].expires, cache[_heap[child]].expires)) {
+            child++;
+        }
+        if (!_before(cache[_heap[child]].expires, cache[idx].expires)) {
+            break;
+        }
+        _heap_set(pos, _heap[child]);
+    }
+    _heap_set(pos, idx);
 }
 
-static uint8_t _addr_len(int family)
+static void _remove(uint8_t idx)
 {
-    switch (family) {
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A)
-    case AF_INET:
-        return sizeof(ipv4_addr_t);
-#endif
-#if IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-   case AF_INET6:
-        return sizeof(ipv6_addr_t);
-#endif
-    case AF_UNSPEC:
-        return 0;
-    default:
-        return 255;
+    uint8_t *link = _bucket(cache[idx].hash);
+
+    DEBUG("dns_cache[%u] remove\n", idx);
+    while (*link != idx + 1) {
+        link = &cache[*link - 1].next;
+    }
+    *link = cache[idx].next;
+
+    /* fill the gap with the last entry of the heap, the removed entry
+     * becomes the first free one */
+    unsigned pos = cache[idx].heap_pos;
+    uint8_t last = _heap[--_used];
+    _heap_set(_used, idx);
+    if (pos < _used) {
+        _heap_set(pos, last);
+        _sift_down(pos);
+        _sift_up(cache[last].heap_pos);
     }
 }
 
-static uint32_t _hash(const void *data, size_t len)
+static void _expire(uint32_t now)
 {
-    return fletcher32(data, (len + 1) / 2);
+    while (_used && _before(cache[_heap[0]].expires, now)) {
+        DEBUG("dns_cache[%u] expired\n", _heap[0]);
+        _remove(_heap[0]);
+    }
 }
 
 int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
     int res = 0;
-    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
-    uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
 
+    if ((addr_len == 255) || !_name_fits(domain_name)) {
+        return 0;
+    }
+
+    uint64_t hash = _hash(domain_name);
+
     mutex_lock(&cache_mutex);
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        /* empty slot */
-        if (_is_empty(i)) {
+    _expire(_now());
+    for (uint8_t i = *_bucket(hash); i != NIL; i = cache[i - 1].next) {
+        unsigned idx = i - 1;
+
+        if (!_matches(idx, hash, domain_name)) {
             continue;
         }
-        /* TTL expired - invalidate slot */
-        if (now > cache[i].expires) {
-            DEBUG("dns_cache[%u] expired\n", i);
-            _set_empty(i);
+        if (cache[idx].negative) {
+            if (!cache[idx].len || (cache[idx].len == addr_len)) {
+                DEBUG("dns_cache[%u] negative hit\n", idx);
+                res = -ENOENT;
+            }
             continue;
         }
-        /* check if hash and length match */
-        if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
-            DEBUG("dns_cache[%u] hit\n", i);
-            memcpy(addr_out, &cache[i].addr, _get_len(i));
-            res = _get_len(i);
+        if (!addr_len || (addr_len == cache[idx].len)) {
+            DEBUG("dns_cache[%u] hit\n", idx);
+            memcpy(addr_out, &cache[idx].addr, cache[idx].len);
+            res = cache[idx].len;
             break;
         }
     }
@@ -152,56 +246,91 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family)
     return res;
 }
 
-static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+static void _add(const char *domain_name, const void *addr, uint8_t len,
+                 bool negative, uint32_t ttl)
 {
-    DEBUG("dns_cache[%u] add cache entry\n", i);
-    cache[i].hash = hash;
-    cache[i].expires = expires;
-    memcpy(&cache[i].addr, addr_out, addr_len);
-    _set_len(i, addr_len);
-}
-
-void dns_cache_add(const char *domain_name, const void *addr_out,
-                        int addr_len, uint32_t ttl)
-{
-    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
-    uint32_t hash = _hash(domain_name, strlen(domain_name));
-    uint32_t oldest = ttl;
-    int idx = -1;
+    if (!_name_fits(domain_name)) {
+        DEBUG("dns_cache: %s is too long to be cached\n", domain_name);
+        return;
+    }
 
-    assert(addr_len == 4 || addr_len == 16);
-    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+    uint32_t now = _now();
+    uint64_t hash = _hash(domain_name);
+    uint8_t *bucket = _bucket(hash);
 
     mutex_lock(&cache_mutex);
-    /* iterate even if TTL = 0 just in case we need to expire */
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
-        }
-        if (cache[i].hash == hash && _get_len(i) == addr_len) {
-            DEBUG("dns_cache[%u] update ttl\n", i);
-            if (ttl) {
-                cache[i].expires = now + ttl;
-            }
-            else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
-            }
-            goto exit;
+    if (!_initialized) {
+        for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; i++) {
+            _heap_set(i, i);
         }
-        uint32_t _ttl = cache[i].expires - now;
-        if (_ttl < oldest) {
-            oldest = _ttl;
-            idx = i;
+        _initialized = true;
+    }
+    _expire(now);
+
+    /* drop the entries the new one supersedes, a TTL of 0 only does this */
+    for (uint8_t i = *bucket, next; i != NIL; i = next) {
+        unsigned idx = i - 1;
+
+        next = cache[idx].next;
+        if (_matches(idx, hash, domain_name) &&
+            ((cache[idx].len == len) || (negative && !len) ||
+             (cache[idx].negative && !cache[idx].len))) {
+            _remove(idx);
         }
     }
+    if (ttl == 0) {
+        goto exit;
+    }
 
-    if (ttl && idx >= 0) {
+    if (_used == CONFIG_DNS_CACHE_SIZE) {
+        if (!_before(cache[_heap[0]].expires, now + ttl)) {
+            DEBUG("dns_cache: full\n");
+            goto exit;
+        }
         DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+        _remove(_heap[0]);
     }
+
+    uint8_t idx = _heap[_used++];
+    DEBUG("dns_cache[%u] add cache entry\n", idx);
+    cache[idx].hash = hash;
+    cache[idx].expires = now + ttl;
+    cache[idx].len = len;
+    cache[idx].negative = negative;
+#if STORE_NAMES
+    strcpy(cache[idx].name, domain_name);
+#endif
+    if (!negative) {
+        memcpy(&cache[idx].addr, addr, len);
+    }
+    _sift_up(_used - 1);
+    cache[idx].next = *bucket;
+    *bucket = idx + 1;
 exit:
     mutex_unlock(&cache_mutex);
 }
+
+void dns_cache_add(const char *domain_name, const void *addr_out,
+                        int addr_len, uint32_t ttl)
+{
+    assert(addr_len == 4 || addr_len == 16);
+    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+
+    if ((unsigned)addr_len > sizeof(cache[0].addr)) {
+        return;
+    }
+    _add(domain_name, addr_out, addr_len, false, ttl);
+}
+
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl)
+{
+    uint8_t len = _addr_len(family);
+
+    DEBUG("dns_cache: %s has no address, lifetime %"PRIu32" s\n",
+          domain_name, ttl);
+
+    if (len == 255) {
+        return;
+    }
+    _add(domain_name, NULL, len, true, ttl);
+}
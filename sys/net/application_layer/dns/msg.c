@@ -212,4 +212,26 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
     return -EBADMSG;
 }
 
+bool dns_msg_reply_is_negative(const uint8_t *buf, size_t len)
+{
+    const dns_hdr_t *hdr = (dns_hdr_t *)buf;
+
+    if (len < sizeof(*hdr)) {
+        return false;
+    }
+
+    uint16_t flags = ntohs(hdr->flags);
+    if (!(flags & DNS_FLAG_QR)) {
+        return false;
+    }
+    switch (flags & DNS_FLAG_RCODE_MASK) {
+    case DNS_RCODE_NXDOMAIN:
+        return true;
+    case DNS_RCODE_NOERROR:
+        return hdr->ancount == 0;
+    default:
+        return false;
+    }
+}
+
 /** @} */
@@ -120,7 +120,7 @@ int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
 {
     int res;
 
-    if ((res = dns_cache_query(domain_name, addr_out, family)) > 0) {
+    if ((res = dns_cache_query(domain_name, addr_out, family)) != 0) {
         return res;
     }
 
@@ -737,6 +737,14 @@ static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
                 ttl += max_age;
                 dns_cache_add(_domain_name_from_ctx(context), context->addr_out, context->res, ttl);
             }
+            else if ((context->res <= 0) &&
+                     dns_msg_reply_is_negative(data, data_len)) {
+                DEBUG("gcoap_dns: %s has no address\n",
+                      _domain_name_from_ctx(context));
+                dns_cache_add_negative(_domain_name_from_ctx(context), family,
+                                       CONFIG_DNS_CACHE_NEGATIVE_TTL);
+                context->res = -ENOENT;
+            }
             else if (ENABLE_DEBUG && (context->res < 0)) {
                 DEBUG("gcoap_dns: Unable to parse DNS reply: %d\n",
                       context->res);
@@ -15,11 +15,13 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
 #include <stdbool.h>
 
 #include "event.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
+#include "net/sock/util.h"
 #include "uri_parser.h"
 #include "ztimer.h"
 
@@ -33,6 +35,7 @@
 #include "debug.h"
 
 #define CLIENT_EP_FLAGS_IN_USE          0x80
+#define CLIENT_EP_FLAGS_UPSTREAM        0x40
 #define CLIENT_EP_FLAGS_RESP_TYPE_MASK  0x30
 #define CLIENT_EP_FLAGS_RESP_TYPE_POS   4U
 #define CLIENT_EP_FLAGS_ETAG_LEN_MASK   0x0f
@@ -44,7 +47,7 @@ extern uint16_t gcoap_next_msg_id(void);
 extern void gcoap_forward_proxy_post_event(void *arg);
 
 static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
-static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+static client_ep_t _client_eps[CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX];
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -101,11 +104,12 @@ static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
 {
     client_ep_t *cep;
     for (cep = _client_eps;
-         cep < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
+         cep < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
          cep++) {
         if (!_cep_in_use(cep)) {
             _cep_set_in_use(cep);
             _cep_set_req_etag(cep, NULL, 0);
+            cep->upstream = NULL;
             memcpy(&cep->ep, ep, sizeof(*ep));
             DEBUG("Client_ep is allocated %p\n", (void *)cep);
             return cep;
@@ -120,6 +124,108 @@ static void _free_client_ep(client_ep_t *cep)
     /* timer removed but event could be queued */
     cep->flags = 0;
     DEBUG("Client_ep is freed %p\n", (void *)cep);
+
+    /* clients still waiting for this request won't get a response */
+    for (client_ep_t *waiting = _client_eps;
+         waiting < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         waiting++) {
+        if (_cep_in_use(waiting) && (waiting->upstream == cep)) {
+            _free_client_ep(waiting);
+        }
+    }
+}
+
+#if CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN
+static_assert(CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN <= UINT8_MAX,
+              "CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN must fit client_ep_t::req_len");
+
+/* FNV-1a over the request data and the server address */
+static uint32_t _req_hash(const uint8_t *req, size_t len,
+                          const sock_udp_ep_t *server)
+{
+    uint32_t hash = 2166136261U;
+
+    for (unsigned i = 0; i < sizeof(server->addr); i++) {
+        hash = (hash ^ ((const uint8_t *)&server->addr)[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < len; i++) {
+        hash = (hash ^ req[i]) * 16777619U;
+    }
+    return hash;
+}
+#endif
+
+/* keeps everything identifying the forwarded request, except for message ID
+ * and token, returns false if it does not fit */
+static bool _req_store(client_ep_t *cep)
+{
+#if CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN
+    const uint8_t *start = coap_get_token(&cep->pdu) + coap_get_token_len(&cep->pdu);
+    size_t len = cep->pdu.buf + coap_get_total_len(&cep->pdu) - start;
+
+    if (len >= sizeof(cep->req)) {
+        return false;
+    }
+    cep->req[0] = coap_get_code_raw(&cep->pdu);
+    memcpy(&cep->req[1], start, len);
+    cep->req_len = len + 1;
+    cep->req_hash = _req_hash(cep->req, cep->req_len, &cep->server_ep);
+    return true;
+#else
+    (void)cep;
+    return false;
+#endif
+}
+
+/* only safe requests can share a response, and not with Observe, as the
+ * notifications would only go to one of the clients */
+static bool _can_share_response(coap_pkt_t *client_pkt, client_ep_t *cep)
+{
+    unsigned method = coap_get_code_raw(client_pkt);
+
+    return ((method == COAP_METHOD_GET) || (method == COAP_METHOD_FETCH)) &&
+           !coap_has_observe(client_pkt) &&
+           (cep->token_len <= sizeof(cep->token)) &&
+           (_cep_get_req_etag_len(cep) == 0);
+}
+
+/* true if a request by the client with this message ID is already handled,
+ * i.e. the client retransmitted it */
+static bool _is_duplicate(client_ep_t *cep)
+{
+    for (client_ep_t *other = _client_eps;
+         other < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         other++) {
+        if ((other != cep) && _cep_in_use(other) && (other->mid == cep->mid) &&
+            sock_udp_ep_equal(&other->ep, &cep->ep)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* finds an identical request already forwarded to the server, the hash only
+ * rules out most of the others before comparing the requests */
+static client_ep_t *_find_upstream(client_ep_t *cep)
+{
+#if CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN
+    for (client_ep_t *other = _client_eps;
+         other < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         other++) {
+        if ((other != cep) && _cep_in_use(other) &&
+            (other->flags & CLIENT_EP_FLAGS_UPSTREAM) &&
+            (other->req_hash == cep->req_hash) &&
+            (other->tl_type == cep->tl_type) &&
+            (other->req_len == cep->req_len) &&
+            !memcmp(other->req, cep->req, cep->req_len) &&
+            sock_udp_ep_equal(&other->server_ep, &cep->server_ep)) {
+            return other;
+        }
+    }
+#else
+    (void)cep;
+#endif
+    return NULL;
 }
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
@@ -264,6 +370,37 @@ static void _set_response_type(coap_pkt_t *pdu, uint8_t resp_type)
     }
 }
 
+/* sends the response to every client waiting for the request of cep, with
+ * the message ID and token of their own request */
+static void _forward_resp_to_waiting(client_ep_t *cep, coap_pkt_t *pdu)
+{
+    static uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    size_t hdr_len = coap_get_total_hdr_len(pdu);
+    size_t rest_len = coap_get_total_len(pdu) - hdr_len;
+    unsigned code = coap_get_code_raw(pdu);
+
+    for (client_ep_t *waiting = _client_eps;
+         waiting < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         waiting++) {
+        if (!_cep_in_use(waiting) || (waiting->upstream != cep)) {
+            continue;
+        }
+        ztimer_remove(ZTIMER_MSEC, &waiting->empty_ack_timer);
+
+        uint8_t type = (code == COAP_CODE_EMPTY) ? COAP_TYPE_RST
+                                                 : _cep_get_response_type(waiting);
+        uint16_t mid = (type == COAP_TYPE_CON) ? gcoap_next_msg_id() : waiting->mid;
+        ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), type, waiting->token,
+                                         (code == COAP_CODE_EMPTY) ? 0 : waiting->token_len,
+                                         code, mid);
+        if ((len > 0) && ((size_t)len + rest_len <= sizeof(buf))) {
+            memcpy(&buf[len], pdu->buf + hdr_len, rest_len);
+            _dispatch_msg(buf, len + rest_len, &waiting->ep, &waiting->proxy_ep);
+        }
+        _free_client_ep(waiting);
+    }
+}
+
 static void _forward_resp_handler(const gcoap_request_memo_t *memo,
                                   coap_pkt_t* pdu,
                                   const sock_udp_ep_t *remote)
@@ -279,6 +416,9 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
            memo->state == GCOAP_MEMO_RESP_TRUNC ||
            memo->state == GCOAP_MEMO_TIMEOUT);
     if (memo->state == GCOAP_MEMO_RESP) {
+        /* before the response is possibly turned into a 2.03 for cep */
+        _forward_resp_to_waiting(cep, pdu);
+
         uint8_t req_etag_len = _cep_get_req_etag_len(cep);
 
         if (req_etag_len > 0) {
@@ -318,12 +458,14 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
         assert(buf_len >= (sizeof(coap_udp_hdr_t) + 4U));
         gcoap_resp_init(pdu, pdu->buf, buf_len, COAP_CODE_INTERNAL_SERVER_ERROR);
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+        _forward_resp_to_waiting(cep, pdu);
         _set_response_type(pdu, _cep_get_response_type(cep));
     }
     else if (memo->state == GCOAP_MEMO_TIMEOUT) {
         /* send RST */
         gcoap_resp_init(pdu, pdu->buf, buf_len, COAP_CODE_EMPTY);
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+        _forward_resp_to_waiting(cep, pdu);
     }
     /* don't use buf_len here, in case the above `gcoap_resp_init`s changed `pdu` */
     _dispatch_msg(pdu->buf, coap_get_total_len(pdu), &cep->ep, &cep->proxy_ep);
@@ -419,7 +561,7 @@ int gcoap_forward_proxy_req_send(client_ep_t *cep)
     int len;
     if ((len = gcoap_req_send(cep->pdu.buf, coap_get_total_len(&cep->pdu),
                              &cep->server_ep, NULL, _forward_resp_handler, cep,
-                             GCOAP_SOCKET_TYPE_UNDEF)) <= 0) {
+                             cep->tl_type)) <= 0) {
         DEBUG("gcoap_forward_proxy_req_send(): gcoap_req_send failed %d\n", len);
         _free_client_ep(cep);
     }
@@ -442,7 +584,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
        and retransmissions. In the future, the proxy should set an
        empty ACK message to stop the retransmissions of a client */
     gcoap_forward_proxy_find_req_memo(&memo, client_pkt, &client_ep->server_ep);
-    if (memo) {
+    if (memo || _is_duplicate(client_ep)) {
         DEBUG("gcoap_forward_proxy: request already exists, ignore!\n");
         _free_client_ep(client_ep);
         return 0;
@@ -467,6 +609,17 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
         _free_client_ep(client_ep);
         return -EINVAL;
     }
+
+    if (_can_share_response(client_pkt, client_ep) && _req_store(client_ep)) {
+        client_ep->upstream = _find_upstream(client_ep);
+        if (client_ep->upstream) {
+            DEBUG("gcoap_forward_proxy: waiting for response to %p\n",
+                  (void *)client_ep->upstream);
+            return 0;
+        }
+        client_ep->flags |= CLIENT_EP_FLAGS_UPSTREAM;
+    }
+
     if (IS_USED(MODULE_GCOAP_FORWARD_PROXY_THREAD)) {
         /* WORKAROUND: DTLS communication is blocking the gcoap thread,
          * therefore the communication should be handled in the proxy thread */
@@ -490,12 +643,16 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
     ssize_t optlen = 0;
 
     client_ep_t *cep = _allocate_client_ep(client);
-    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
     if (!cep) {
         return -ENOMEM;
     }
+    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
 
     cep->mid = coap_get_id(pkt);
+    cep->token_len = coap_get_token_len(pkt);
+    if (cep->token_len <= sizeof(cep->token)) {
+        memcpy(cep->token, coap_get_token(pkt), cep->token_len);
+    }
     _cep_set_response_type(
         cep,
         (coap_get_type(pkt) == COAP_TYPE_CON) ? COAP_TYPE_ACK : COAP_TYPE_NON
@@ -519,7 +676,9 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
 
     /* target is using CoAP */
     if (!strncmp("coap", urip.scheme, urip.scheme_len) ||
-        !strncmp("coaps", urip.scheme, urip.scheme_len)) {
+        (IS_USED(MODULE_GCOAP_DTLS) && !strncmp("coaps", urip.scheme, urip.scheme_len))) {
+        cep->tl_type = (urip.scheme_len == 5) ? GCOAP_SOCKET_TYPE_DTLS
+                                              : GCOAP_SOCKET_TYPE_UDP;
         /* client context ownership is passed to gcoap_forward_proxy_req_send() */
         int res = _gcoap_forward_proxy_via_coap(pkt, cep, &urip);
         if (res < 0) {
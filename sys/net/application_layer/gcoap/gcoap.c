@@ -32,6 +32,7 @@
 #include "net/ipv6/addr.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
+#include "net/nanocoap/path_index.h"
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
@@ -63,6 +64,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remote,
                                 uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len,
@@ -87,10 +90,12 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo,
                           sock_udp_ep_t *remote, sock_udp_ep_t *local,
                           coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
-                                   const coap_resource_t *resource);
-
+                                   const coap_resource_t *resource,
+                                   const sock_udp_ep_t *observer);
+static void _expire_obs_memo(gcoap_observe_memo_t *memo);
 static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
                                                 uint16_t last_notify_mid);
+static void _check_obs_memo_ack(sock_udp_ep_t *remote, uint16_t mid);
 
 static nanocoap_cache_entry_t *_cache_lookup_memo(gcoap_request_memo_t *cache_key);
 static void _cache_process(gcoap_request_memo_t *memo,
@@ -152,6 +157,14 @@ static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
 };
 
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+/* Resource path indices of the listeners using the default request matcher */
+static struct {
+    const gcoap_listener_t *listener;
+    coap_path_index_t index;
+} _path_indices[CONFIG_GCOAP_PATH_INDEX_LISTENERS_MAX];
+#endif
+
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
 static event_queue_t _queue;
@@ -322,6 +335,22 @@ static void _dtls_free_up_session(void *arg) {
 }
 #endif /* MODULE_GCOAP_DTLS */
 
+/*
+ * Checks if a received datagram can be processed in the receive buffer of the
+ * network stack instead of copying it to _listen_buf first.
+ *
+ * This is only done for requests: handlers write the response to _listen_buf
+ * anyway, while responses are modified in place (e.g. by the forward proxy).
+ * It also needs the stack to hand out the datagram as one slice, which GNRC
+ * always does.
+ */
+static inline bool _recv_in_place(const uint8_t *data, size_t len)
+{
+    return IS_USED(MODULE_GNRC_SOCK_UDP) &&
+           (len > sizeof(coap_udp_hdr_t)) &&
+           ((data[1] >> 5) == COAP_CLASS_REQ) && (data[1] != COAP_CODE_EMPTY);
+}
+
 /* Handles UDP socket events from the event queue. */
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
@@ -331,22 +360,20 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     if (type & SOCK_ASYNC_MSG_RECV) {
         void *stackbuf;
         void *buf_ctx = NULL;
+        uint8_t *pdu_buf = _listen_buf;
         bool truncated = false;
         size_t cursor = 0;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
-        /* The zero-copy _buf API is not used to its full potential here -- we
-         * still copy out data in what is a manual version of sock_udp_recv,
-         * but this gives the direly needed overflow information.
+        /* Requests are parsed right in the buffer of the network stack, which
+         * is only released after processing. Everything else is copied out in
+         * what is a manual version of sock_udp_recv, but this gives the
+         * direly needed overflow information.
          *
-         * A version that actually doesn't copy would vastly change the way
-         * gcoap passes the buffer to be read from and written into to the
-         * handler. Also, given that neither nanocoap nor the handler expects
-         * to gather scattered data, it'd need to rely on the data coming in a
-         * single slice (but that may be a realistic assumption).
-         */
+         * nanocoap does not expect to gather scattered data, so processing in
+         * place relies on the data coming in a single slice. */
         while (true) {
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
             if (res < 0) {
@@ -360,6 +387,11 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
                 res = sizeof(_listen_buf) - cursor;
                 truncated = true;
             }
+            if ((cursor == 0) && _recv_in_place(stackbuf, res)) {
+                pdu_buf = stackbuf;
+                cursor = res;
+                break;
+            }
             memcpy(&_listen_buf[cursor], stackbuf, res);
             cursor += res;
         }
@@ -384,7 +416,12 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        _process_coap_pdu(&socket, &remote, aux_out_ptr, pdu_buf, cursor, truncated);
+
+        if (pdu_buf != _listen_buf) {
+            /* release the datagram processed in place */
+            sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, NULL, NULL);
+        }
     }
 }
 
@@ -412,11 +449,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     gcoap_request_memo_t *memo = NULL;
     /* Code paths that necessitate a response on the message layer can set a
      * response type here (COAP_TYPE_RST or COAP_TYPE_ACK). If set, at the end
-     * of the function there will be
-     *   * that value will be put in the code field,
-     *   * token length cleared,
-     *   * code set to EMPTY, and
-     *   * the message is returned with the rest of its header intact.
+     * of the function an empty message of that type with the message ID of
+     * the received message is returned.
      */
     int8_t messagelayer_emptyresponse_type = NO_IMMEDIATE_REPLY;
 
@@ -462,6 +496,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                 if ((memo != NULL) && (memo->send_limit != GCOAP_SEND_LIMIT_NON)) {
                     DEBUG("gcoap: empty ACK processed, stopping retransmissions\n");
                     _cease_retransmission(memo);
+                } else if (CONFIG_GCOAP_OBS_CON_INTERVAL) {
+                    /* may acknowledge a confirmable notification */
+                    _check_obs_memo_ack(remote, coap_get_id(&pdu));
                 } else {
                     DEBUG("gcoap: empty ACK matches no known CON, ignoring\n");
                 }
@@ -584,11 +621,12 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     }
 
     if (messagelayer_emptyresponse_type != NO_IMMEDIATE_REPLY) {
-        coap_pkt_set_type(&pdu, messagelayer_emptyresponse_type);
-        coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
-        coap_pkt_set_tkl(&pdu, 0);
+        /* buf may belong to the network stack, so don't reuse it */
+        uint8_t hdr[sizeof(coap_udp_hdr_t)];
 
-        ssize_t bytes = _tl_send(sock, buf, sizeof(coap_udp_hdr_t), remote, aux);
+        coap_build_udp_hdr(hdr, sizeof(hdr), messagelayer_emptyresponse_type,
+                           NULL, 0, COAP_CODE_EMPTY, coap_get_id(&pdu));
+        ssize_t bytes = _tl_send(sock, hdr, sizeof(hdr), remote, aux);
         if (bytes <= 0) {
             DEBUG("gcoap: empty response failed: %" PRIdSIZE "\n", bytes);
         }
@@ -687,8 +725,8 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
+            /* find observe registration of the remote for resource */
+            _find_obs_memo_resource(&resource_memo, resource, remote);
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -718,7 +756,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         }
         /* initialize new registration request */
         if ((memo == NULL) && coap_has_observe(pdu)) {
-            /* verify resource not already registered (for another endpoint) */
+            /* verify resource not already registered (for another transport) */
             if ((empty_slot >= 0) && (resource_memo == NULL)) {
                 int slot = _find_observer(&observer, remote);
                 /* cache new observer */
@@ -759,6 +797,10 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             if (memo->token_len) {
                 memcpy(&memo->token[0], coap_get_token(pdu), memo->token_len);
             }
+            /* (re-)registration shows the observer is alive */
+            memo->con_countdown = CONFIG_GCOAP_OBS_CON_INTERVAL;
+            memo->con_fails = 0;
+            memo->con_pending = false;
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -767,21 +809,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
-            memo->observer = NULL;
-            gcoap_observe_memo_t *other_memo = NULL;
-            _find_obs_memo(&other_memo, remote, NULL, NULL);
-            if (other_memo == NULL) {
-                _find_observer(&observer, remote);
-                if (observer != NULL) {
-                    observer->family = AF_UNSPEC;
-                }
-            }
-            other_memo = NULL;
-            _find_obs_memo(&other_memo, NULL, memo->notifier, NULL);
-            if (!other_memo) {
-                memo->notifier->family = AF_UNSPEC;
-            }
-            memo->notifier = NULL;
+            _expire_obs_memo(memo);
         }
         coap_clear_observe(pdu);
 
@@ -836,6 +864,25 @@ static int _request_matcher_default(gcoap_listener_t *listener,
 {
     uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
     int ret = GCOAP_RESOURCE_NO_PATH;
+    coap_method_flags_t method_flag = coap_method2flag(
+        coap_get_code_detail(pdu));
+
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+    for (unsigned i = 0; i < ARRAY_SIZE(_path_indices); i++) {
+        if (_path_indices[i].listener != listener) {
+            continue;
+        }
+        switch (coap_path_index_find(&_path_indices[i].index, pdu, method_flag,
+                                     resource)) {
+        case 0:
+            return GCOAP_RESOURCE_FOUND;
+        case -EPERM:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        default:
+            return GCOAP_RESOURCE_NO_PATH;
+        }
+    }
+#endif
 
     if (coap_get_uri_path(pdu, uri) <= 0) {
         /* The Uri-Path options are longer than
@@ -844,9 +891,6 @@ static int _request_matcher_default(gcoap_listener_t *listener,
         return GCOAP_RESOURCE_NO_PATH;
     }
 
-    coap_method_flags_t method_flag = coap_method2flag(
-        coap_get_code_detail(pdu));
-
     *resource = NULL;
     while ((*resource = _match_resource_path_iterator(listener, *resource, uri))) {
         /* potential match, check for method */
@@ -1210,41 +1254,85 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
         }
 
         if (stale_obs_memo) {
-            stale_obs_memo->observer = NULL; /* clear memo */
-             /* check if no other memo is referencing the same local endpoint ...  */
-            gcoap_observe_memo_t *other_memo = NULL;
-            _find_obs_memo(&other_memo, NULL, stale_obs_memo->notifier, NULL);
-            if (!other_memo) {
-                /* ... if not -> also free the notifier entry */
-                stale_obs_memo->notifier->family = AF_UNSPEC;
-            }
-            /* then unreference notifier */
-            stale_obs_memo->notifier = NULL;
-
-            /* check if the observer has more observe memos registered... */
-            stale_obs_memo = NULL;
-            _find_obs_memo(&stale_obs_memo, observer, NULL, NULL);
-            if (stale_obs_memo == NULL) {
-                /* ... if not -> also free the observer entry */
-                observer->family = AF_UNSPEC;
-            }
+            _expire_obs_memo(stale_obs_memo);
         }
     }
 }
 
+/*
+ * Clears an observe memo, and frees the observer and notifier entries if no
+ * other memo references them.
+ */
+static void _expire_obs_memo(gcoap_observe_memo_t *memo)
+{
+    sock_udp_ep_t *observer = memo->observer;
+    gcoap_observe_memo_t *other_memo = NULL;
+
+    memo->observer = NULL; /* clear memo */
+    /* check if no other memo is referencing the same local endpoint ...  */
+    _find_obs_memo(&other_memo, NULL, memo->notifier, NULL);
+    if (!other_memo) {
+        /* ... if not -> also free the notifier entry */
+        memo->notifier->family = AF_UNSPEC;
+    }
+    /* then unreference notifier */
+    memo->notifier = NULL;
+
+    /* check if the observer has more observe memos registered... */
+    other_memo = NULL;
+    _find_obs_memo(&other_memo, observer, NULL, NULL);
+    if (other_memo == NULL) {
+        /* ... if not -> also free the observer entry */
+        observer->family = AF_UNSPEC;
+    }
+}
+
+/*
+ * Marks the confirmable notification with the given msg ID as acknowledged.
+ *
+ * remote[in]             The remote that sent the ACK
+ * mid[in]                The message ID of the ACK
+ */
+static void _check_obs_memo_ack(sock_udp_ep_t *remote, uint16_t mid)
+{
+    sock_udp_ep_t *observer;
+    _find_observer(&observer, remote);
+    if (observer == NULL) {
+        return;
+    }
+
+    mutex_lock(&_coap_state.lock);
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i];
+        if ((memo->observer == observer) && memo->con_pending &&
+            (memo->last_msgid == mid)) {
+            DEBUG("gcoap: notification for %s acknowledged\n", memo->resource->path);
+            memo->con_pending = false;
+            memo->con_fails = 0;
+            break;
+        }
+    }
+    mutex_unlock(&_coap_state.lock);
+}
+
 /*
  * Find registered observe memo for a resource.
  *
  * memo[out] -- Registered observe memo, or NULL if not found
  * resource[in] -- Resource to match
+ * observer[in] -- Remote endpoint to match if not NULL, otherwise the first
+ *                 registration for the resource is returned
  */
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
-                                   const coap_resource_t *resource)
+                                   const coap_resource_t *resource,
+                                   const sock_udp_ep_t *observer)
 {
     *memo = NULL;
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
+                && _coap_state.observe_memos[i].resource == resource
+                && (!observer ||
+                    sock_udp_ep_equal(observer, _coap_state.observe_memos[i].observer))) {
             *memo = &_coap_state.observe_memos[i];
             break;
         }
@@ -1281,11 +1369,22 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
 
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len  = len,
+    };
+
+    return _tl_sendv(sock, &snip, remote, aux);
+}
+
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     ssize_t res = -1;
     switch (sock->type) {
         case GCOAP_SOCKET_TYPE_UDP:
-            res = sock_udp_send_aux(sock->socket.udp, data, len, remote, aux);
+            res = sock_udp_sendv_aux(sock->socket.udp, snips, remote, aux);
             break;
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_DTLS:
@@ -1300,8 +1399,8 @@ static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
             }
 
             /* send application data */
-            res = sock_dtls_send(sock->socket.dtls, &sock->ctx_dtls_session, data, len,
-                                    SOCK_NO_TIMEOUT);
+            res = sock_dtls_sendv(sock->socket.dtls, &sock->ctx_dtls_session, snips,
+                                  SOCK_NO_TIMEOUT);
             switch (res) {
             case -EHOSTUNREACH:
             case -ENOTCONN:
@@ -1646,6 +1745,42 @@ uint16_t gcoap_next_msg_id(void)
     return (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
 }
 
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+static void _path_index_init(gcoap_listener_t *listener)
+{
+    static uint32_t slots[CONFIG_GCOAP_PATH_INDEX_SLOTS];
+    static size_t slots_used;
+    size_t numof = 4;
+    unsigned i;
+
+    for (i = 0; i < ARRAY_SIZE(_path_indices); i++) {
+        if (_path_indices[i].listener == NULL) {
+            break;
+        }
+    }
+
+    /* keep the load factor of the hash table at 3/4 at most */
+    while ((numof / 4) * 3 < listener->resources_len) {
+        numof <<= 1;
+    }
+    if ((i == ARRAY_SIZE(_path_indices)) ||
+        (numof > ARRAY_SIZE(slots) - slots_used) ||
+        (coap_path_index_init(&_path_indices[i].index, listener->resources,
+                              listener->resources_len, &slots[slots_used],
+                              numof) != 0)) {
+        DEBUG("gcoap: no index for listener %p\n", (void *)listener);
+        return;
+    }
+    _path_indices[i].listener = listener;
+    slots_used += numof;
+}
+#else
+static inline void _path_index_init(gcoap_listener_t *listener)
+{
+    (void)listener;
+}
+#endif
+
 void gcoap_register_listener(gcoap_listener_t *listener)
 {
     /* That item will be overridden, ensure that the user expecting different
@@ -1661,6 +1796,9 @@ void gcoap_register_listener(gcoap_listener_t *listener)
 
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
+        if (IS_USED(MODULE_NANOCOAP_PATH_INDEX)) {
+            _path_index_init(listener);
+        }
     }
 }
 
@@ -1938,7 +2076,7 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     gcoap_observe_memo_t *memo = NULL;
 
     mutex_lock(&_coap_state.lock);
-    _find_obs_memo_resource(&memo, resource);
+    _find_obs_memo_resource(&memo, resource, NULL);
     if (memo == NULL) {
         /* Unique return value to specify there is not an observer */
         mutex_unlock(&_coap_state.lock);
@@ -1959,31 +2097,161 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     coap_pkt_init(pdu, buf, len, hdrlen);
 
     _add_generated_observe_option(pdu);
-    /* Store message ID of the last notification sent. This is needed
-        * to match a potential RST returned by a client in order to signal
-        * it does not recognize this notification. */
-    memo->last_msgid = msgid;
 
     return GCOAP_OBS_INIT_OK;
 }
 
+/*
+ * Picks the message type of the next notification to an observer.
+ *
+ * return COAP_TYPE_NON or COAP_TYPE_CON, or -1 to skip the observer
+ */
+static int _obs_notification_type(gcoap_observe_memo_t *memo, uint32_t now)
+{
+    if (!CONFIG_GCOAP_OBS_CON_INTERVAL) {
+        return COAP_TYPE_NON;
+    }
+
+    if (memo->con_pending) {
+        if ((now - memo->con_sent) < CONFIG_GCOAP_OBS_ACK_TIMEOUT_MS) {
+            /* don't pile up notifications on a slow observer, but make sure
+             * it gets the state confirmable once it caught up */
+            memo->con_countdown = 1;
+            return -1;
+        }
+        memo->con_pending = false;
+        if (++memo->con_fails >= CONFIG_GCOAP_OBS_CON_FAILS_MAX) {
+            DEBUG("gcoap: observer of %s unresponsive, removing\n",
+                  memo->resource->path);
+            _expire_obs_memo(memo);
+            return -1;
+        }
+        memo->con_countdown = 1;
+    }
+
+    if (memo->con_countdown > 1) {
+        memo->con_countdown--;
+        return COAP_TYPE_NON;
+    }
+    memo->con_countdown = CONFIG_GCOAP_OBS_CON_INTERVAL;
+    memo->con_pending = true;
+    memo->con_sent = now;
+    return COAP_TYPE_CON;
+}
+
+/* Sends the batched notifications, returns the number sent */
+static unsigned _obs_send_batch(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                                unsigned num)
+{
+    if (num == 0) {
+        return 0;
+    }
+
+    int res = sock_udp_sendmmsg(sock, msgs, num);
+    if (res < 0) {
+        DEBUG("gcoap: sending notifications failed: %d\n", res);
+        return 0;
+    }
+    return res;
+}
+
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
-    ssize_t ret = 0;
+    /* the last slot is for notifications sent one by one, so they don't
+     * overwrite the headers of a pending batch */
+    uint8_t hdrs[CONFIG_GCOAP_OBS_SEND_BATCH + 1][GCOAP_HEADER_MAXLEN];
+    iolist_t snips[CONFIG_GCOAP_OBS_SEND_BATCH + 1][2];
+    sock_udp_aux_tx_t auxs[CONFIG_GCOAP_OBS_SEND_BATCH + 1];
+    sock_udp_mmsg_t msgs[CONFIG_GCOAP_OBS_SEND_BATCH];
+    sock_udp_t *batch_sock = NULL;
+    unsigned num = 0;
+    unsigned sent = 0;
     gcoap_observe_memo_t *memo = NULL;
-    _find_obs_memo_resource(&memo, resource);
 
-    if (memo) {
-        sock_udp_aux_tx_t aux = { 0 };
+    _find_obs_memo_resource(&memo, resource, NULL);
+    if (memo == NULL) {
+        mutex_unlock(&_coap_state.lock);
+        return 0;
+    }
+
+    /* gcoap_obs_init() wrote the header for this memo, options and payload
+     * following it are the same for all observers */
+    unsigned code = ((const coap_udp_hdr_t *)(const void *)buf)->code;
+    ssize_t skip = coap_build_udp_hdr(hdrs[0], sizeof(hdrs[0]), COAP_TYPE_NON,
+                                      memo->token, memo->token_len, code, 0);
+    if ((skip <= 0) || ((size_t)skip > len)) {
+        mutex_unlock(&_coap_state.lock);
+        return 0;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        memo = &_coap_state.observe_memos[i];
+        if ((memo->observer == NULL) || (memo->resource != resource)) {
+            continue;
+        }
+
+        int type = _obs_notification_type(memo, now);
+        if (type < 0) {
+            continue;
+        }
+
+        bool batched = (memo->socket.type == GCOAP_SOCKET_TYPE_UDP);
+        if (batched && ((num == CONFIG_GCOAP_OBS_SEND_BATCH) ||
+                        (memo->socket.socket.udp != batch_sock))) {
+            sent += _obs_send_batch(batch_sock, msgs, num);
+            num = 0;
+        }
+
+        unsigned slot = batched ? num : CONFIG_GCOAP_OBS_SEND_BATCH;
+        uint16_t msgid = gcoap_next_msg_id();
+        ssize_t hdrlen = coap_build_udp_hdr(hdrs[slot], sizeof(hdrs[slot]), type,
+                                            memo->token, memo->token_len, code,
+                                            msgid);
+        if (hdrlen <= 0) {
+            continue;
+        }
+        /* Store message ID of the last notification sent. This is needed
+         * to match a potential RST returned by a client in order to signal
+         * it does not recognize this notification, or the ACK of a
+         * confirmable one. */
+        memo->last_msgid = msgid;
+
+        snips[slot][0] = (iolist_t){
+            .iol_next = &snips[slot][1],
+            .iol_base = hdrs[slot],
+            .iol_len  = hdrlen,
+        };
+        snips[slot][1] = (iolist_t){
+            .iol_base = (uint8_t *)buf + skip,
+            .iol_len  = len - skip,
+        };
+        /* send from the local address the registration was received on */
+        auxs[slot] = (sock_udp_aux_tx_t){ 0 };
         if (memo->notifier) {
-            memcpy(&aux.local, memo->notifier, sizeof(*memo->notifier));
-            aux.flags = SOCK_AUX_SET_LOCAL;
+            memcpy(&auxs[slot].local, memo->notifier, sizeof(*memo->notifier));
+            auxs[slot].flags = SOCK_AUX_SET_LOCAL;
+        }
+
+        if (batched) {
+            msgs[num++] = (sock_udp_mmsg_t){
+                .snips  = snips[slot],
+                .remote = memo->observer,
+                .aux    = &auxs[slot],
+            };
+            batch_sock = memo->socket.socket.udp;
+            continue;
+        }
+
+        if (_tl_sendv(&memo->socket, snips[slot], memo->observer, &auxs[slot]) > 0) {
+            sent++;
         }
-        ret = _tl_send(&memo->socket, buf, len, memo->observer, &aux);
     }
+    sent += _obs_send_batch(batch_sock, msgs, num);
+
     mutex_unlock(&_coap_state.lock);
-    return ret <= 0 ? 0 : (size_t)ret;
+    return sent ? len : 0;
 }
 
 uint8_t gcoap_op_state(void)
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include "net/coap.h"
 #include "net/gcoap.h"
+#include "net/gcoap/forward_proxy.h"
 #include "net/sock/udp.h"
 #include "ztimer.h"
 #include "event.h"
@@ -35,13 +36,27 @@ extern "C" {
 /**
  * @brief   client ep structure
  */
-typedef struct {
+typedef struct client_ep {
     coap_pkt_t pdu;                         /**< forward CoAP PDU */
     sock_udp_ep_t server_ep;                /**< forward Server endpoint */
     sock_udp_ep_t ep;                       /**< client endpoint */
     sock_udp_ep_t proxy_ep;                 /**< proxy endpoint */
+    struct client_ep *upstream;             /**< client whose request to the
+                                             *   server is awaited, NULL if
+                                             *   forwarded itself */
+#if CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN
+    uint32_t req_hash;                      /**< hash of the forwarded request */
+    /**
+     * @brief   code, options and payload of the forwarded request
+     */
+    uint8_t req[CONFIG_GCOAP_FORWARD_PROXY_COALESCE_LEN];
+    uint8_t req_len;                        /**< length of @ref req */
+#endif
     uint16_t mid;                           /**< message ID */
     uint8_t flags;                          /**< client flags */
+    uint8_t token_len;                      /**< length of @ref token */
+    uint8_t token[COAP_TOKEN_LENGTH_MAX];   /**< token of the client request */
+    gcoap_socket_type_t tl_type;            /**< transport to the server */
 #if IS_USED(MODULE_NANOCOAP_CACHE)
     uint8_t req_etag[COAP_ETAG_LENGTH_MAX]; /**< request ETag */
 #endif
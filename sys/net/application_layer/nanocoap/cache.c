@@ -27,6 +27,24 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert(CONFIG_NANOCOAP_CACHE_ARENA_SIZE >= CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE,
+              "CONFIG_NANOCOAP_CACHE_ARENA_SIZE must fit the largest response");
+static_assert(!IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_FNV) ||
+              (CONFIG_NANOCOAP_CACHE_KEY_LENGTH <= sizeof(uint64_t)),
+              "FNV cache keys are 8 bytes long");
+
+/* FNV-1a, 64 bit */
+#define FNV_BASIS       (0xcbf29ce484222325ULL)
+#define FNV_PRIME       (0x100000001b3ULL)
+
+typedef struct {
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_FNV)
+    uint64_t fnv;
+#else
+    sha256_context_t sha;
+#endif
+} _digest_t;
+
 static int _cache_replacement_lru(void);
 static int _cache_update_lru(clist_node_t *node);
 
@@ -34,6 +52,10 @@ static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+static uint8_t _arena[CONFIG_NANOCOAP_CACHE_ARENA_SIZE];
+static size_t _arena_used;
+static nanocoap_cache_stats_t _stats;
 
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
@@ -48,6 +70,7 @@ static int _cache_replacement_lru(void)
     }
 
     nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
+    _stats.evictions++;
     return nanocoap_cache_del(lru_ce);
 }
 
@@ -62,11 +85,62 @@ static int _cache_update_lru(clist_node_t *node)
     return -1;
 }
 
+static nanocoap_cache_entry_t **_bucket(const uint8_t *cache_key)
+{
+    /* the keys are digests already, folding them is good enough */
+    unsigned hash = 0;
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_KEY_LENGTH; i++) {
+        hash = (hash * 31) + cache_key[i];
+    }
+    return &_buckets[hash % CONFIG_NANOCOAP_CACHE_BUCKETS];
+}
+
+static void _bucket_remove(nanocoap_cache_entry_t *ce)
+{
+    for (nanocoap_cache_entry_t **pos = _bucket(ce->cache_key); *pos;
+         pos = &(*pos)->bucket_next) {
+        if (*pos == ce) {
+            *pos = ce->bucket_next;
+            ce->bucket_next = NULL;
+            return;
+        }
+    }
+}
+
+static void _arena_free(nanocoap_cache_entry_t *ce)
+{
+    uint8_t *start = ce->response_buf;
+    size_t len = ce->response_len;
+
+    if (start == NULL) {
+        return;
+    }
+
+    /* move all responses stored after this one down to close the gap */
+    memmove(start, start + len, &_arena[_arena_used] - (start + len));
+    _arena_used -= len;
+    ce->response_buf = NULL;
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        nanocoap_cache_entry_t *other = &_cache_entries[i];
+
+        if (other->response_buf > start) {
+            other->response_buf -= len;
+            other->response_pkt.buf -= len;
+            other->response_pkt.payload -= len;
+        }
+    }
+}
+
 void nanocoap_cache_init(void)
 {
     _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(&_stats, 0, sizeof(_stats));
+    _arena_used = 0;
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -83,7 +157,50 @@ size_t nanocoap_cache_free_count(void)
     return clist_count(&_empty_list_head);
 }
 
-static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
+size_t nanocoap_cache_arena_used(void)
+{
+    return _arena_used;
+}
+
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
+static void _digest_init(_digest_t *ctx)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_FNV)
+    ctx->fnv = FNV_BASIS;
+#else
+    sha256_init(&ctx->sha);
+#endif
+}
+
+static void _digest_update(_digest_t *ctx, const void *data, size_t len)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_FNV)
+    const uint8_t *pos = data;
+
+    while (len--) {
+        ctx->fnv = (ctx->fnv ^ *pos++) * FNV_PRIME;
+    }
+#else
+    sha256_update(&ctx->sha, data, len);
+#endif
+}
+
+static void _digest_final(_digest_t *ctx, void *cache_key)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_FNV)
+    /* callers provide room for a SHA-256 digest */
+    memset(cache_key, 0, SHA256_DIGEST_LENGTH);
+    memcpy(cache_key, &ctx->fnv, sizeof(ctx->fnv));
+#else
+    sha256_final(&ctx->sha, cache_key);
+#endif
+}
+
+static void _cache_key_digest_opts(const coap_pkt_t *req, _digest_t *ctx,
         bool include_etag,
         bool include_blockwise)
 {
@@ -111,42 +228,42 @@ static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
                     )) {
                 continue;
             }
-            sha256_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
-            sha256_update(ctx, value, optlen);
+            _digest_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
+            _digest_update(ctx, value, optlen);
         }
     }
 }
 
 void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _digest_t ctx;
+    _digest_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, true);
-    sha256_final(&ctx, cache_key);
+    _digest_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _digest_t ctx;
+    _digest_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, false);
-    sha256_final(&ctx, cache_key);
+    _digest_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _digest_t ctx;
+    _digest_init(&ctx);
 
     _cache_key_digest_opts(req, &ctx, !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
     switch (req->hdr->code) {
         case COAP_METHOD_FETCH:
-            sha256_update(&ctx, req->payload, req->payload_len);
+            _digest_update(&ctx, req->payload, req->payload_len);
             break;
         default:
             break;
     }
-    sha256_final(&ctx, cache_key);
+    _digest_final(&ctx, cache_key);
 }
 
 ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
@@ -154,31 +271,29 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *cache_key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
-
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
+    for (nanocoap_cache_entry_t *ce = *_bucket(cache_key); ce;
+         ce = ce->bucket_next) {
+        if (!memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            _update_strategy(&ce->node);
+            return ce;
+        }
     }
-    return 0;
-}
-
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
+    return NULL;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce = _lookup(key);
 
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    else {
+        _stats.misses++;
+    }
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -199,7 +314,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -277,7 +392,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
     bool add_to_cache = false;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
@@ -286,7 +401,11 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         return NULL;
     }
 
-    if (!ce) {
+    if (ce) {
+        /* the new response may differ in size */
+        _arena_free(ce);
+    }
+    else {
         /* did not find .. get an empty cache container */
         ce = _nanocoap_cache_pop();
         add_to_cache = true;
@@ -307,11 +426,33 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         }
     }
 
+    /* make room in the arena, an updated entry was just moved to the end of
+     * the LRU list, so it is the last one to go */
+    while (_arena_used + resp_len > sizeof(_arena)) {
+        if (clist_lpeek(&_cache_list_head) == &ce->node) {
+            break;
+        }
+        if (_replacement_strategy()) {
+            break;
+        }
+    }
+    if (_arena_used + resp_len > sizeof(_arena)) {
+        if (!add_to_cache) {
+            nanocoap_cache_del(ce);
+        }
+        else {
+            clist_rpush(&_empty_list_head, &ce->node);
+        }
+        return NULL;
+    }
+
     memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
     memcpy(&ce->response_pkt, resp, sizeof(coap_pkt_t));
-    memcpy(&ce->response_buf, resp->hdr, resp_len);
-    ce->response_pkt.hdr = (coap_hdr_t *) ce->response_buf;
-    ce->response_pkt.payload = ce->response_buf + (resp->payload - ((uint8_t *)resp->hdr));
+    ce->response_buf = &_arena[_arena_used];
+    _arena_used += resp_len;
+    memcpy(ce->response_buf, resp->buf, resp_len);
+    ce->response_pkt.buf = ce->response_buf;
+    ce->response_pkt.payload = ce->response_buf + (resp->payload - resp->buf);
     ce->response_len = resp_len;
     ce->request_method = request_method;
 
@@ -321,6 +462,10 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
     if (add_to_cache) {
+        nanocoap_cache_entry_t **bucket = _bucket(ce->cache_key);
+
+        ce->bucket_next = *bucket;
+        *bucket = ce;
         clist_rpush(&_cache_list_head, &ce->node);
     }
 
@@ -347,8 +492,13 @@ int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
     clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
 
     if (entry) {
+        nanocoap_cache_entry_t *ce_entry = container_of(entry,
+                                                        nanocoap_cache_entry_t,
+                                                        node);
         clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
+        _bucket_remove(ce_entry);
+        _arena_free(ce_entry);
+        memset(ce_entry, 0, sizeof(nanocoap_cache_entry_t));
         clist_rpush(&_empty_list_head, entry);
         return 0;
     }
@@ -22,7 +22,10 @@
 #include <fcntl.h>
 
 #include "checksum/fletcher32.h"
+#include "macros/utils.h"
+#include "mutex.h"
 #include "net/nanocoap/fileserver.h"
+#include "net/sock/util.h"
 #include "vfs.h"
 
 #if MODULE_VFS_UTIL
@@ -50,6 +53,52 @@ static void *_event_ctx;
  */
 static mutex_t _event_mtx;
 
+/**
+ * @brief   File kept open between the block requests of a GET
+ */
+typedef struct {
+    char name[COAPFILESERVER_PATH_MAX]; /**< VFS path of the file */
+    sock_udp_ep_t remote;               /**< client that opened the file */
+    uint32_t etag;                      /**< ETag of the file when opened */
+    uint32_t last_used;                 /**< value of @ref _uses at last use */
+    off_t pos;                          /**< position of @ref fd */
+    int fd;                             /**< file descriptor */
+    bool open;                          /**< a file is open */
+#if CONFIG_NANOCOAP_FILESERVER_READ_AHEAD
+    off_t ra_start;                     /**< file offset of @ref ra_buf */
+    size_t ra_len;                      /**< valid bytes in @ref ra_buf */
+    uint8_t ra_buf[CONFIG_NANOCOAP_FILESERVER_READ_AHEAD]; /**< read-ahead */
+#endif
+} _file_t;
+
+static _file_t _files[CONFIG_NANOCOAP_FILESERVER_OPEN_FILES];
+
+#if CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE
+/**
+ * @brief   ETag and size of a file, as of its last stat
+ */
+typedef struct {
+    char name[COAPFILESERVER_PATH_MAX]; /**< VFS path of the file, empty if
+                                             the entry is unused */
+    uint32_t etag;                      /**< ETag of the file */
+    uint32_t size;                      /**< size of the file */
+    uint32_t last_used;                 /**< value of @ref _uses at last use */
+} _etag_entry_t;
+
+static _etag_entry_t _etags[CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE];
+#endif
+
+/**
+ * @brief   Counts the uses of @ref _files and @ref _etags to find the least
+ *          recently used entry
+ */
+static uint32_t _uses;
+
+/**
+ * @brief   Protects @ref _files and @ref _etags from concurrent access
+ */
+static mutex_t _file_mtx;
+
 /**
  * @brief   Structure holding information about present options in a request
  */
@@ -71,6 +120,8 @@ struct requestoptions {
 struct requestdata {
     /** 0-terminated expanded file name in the VFS */
     char namebuf[COAPFILESERVER_PATH_MAX];
+    /** client that sent the request, may be NULL */
+    const sock_udp_ep_t *remote;
     struct requestoptions options;
 };
 
@@ -203,6 +254,261 @@ static inline void _event_file(nanocoap_fileserver_event_t event, struct request
     }
 }
 
+/* true if name is path or lies below the directory path, NULL matches all */
+static bool _path_affected(const char *name, const char *path)
+{
+    if (path == NULL) {
+        return true;
+    }
+
+    size_t len = strlen(path);
+    return !strncmp(name, path, len) && ((name[len] == '\0') || (name[len] == '/'));
+}
+
+#if CONFIG_NANOCOAP_FILESERVER_ETAG_CACHE
+static bool _etag_get(const char *name, uint32_t *etag, uint32_t *size)
+{
+    bool found = false;
+
+    mutex_lock(&_file_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_etags); i++) {
+        _etag_entry_t *entry = &_etags[i];
+        if (!strcmp(entry->name, name)) {
+            entry->last_used = ++_uses;
+            *etag = entry->etag;
+            if (size) {
+                *size = entry->size;
+            }
+            found = true;
+            break;
+        }
+    }
+    mutex_unlock(&_file_mtx);
+    return found;
+}
+
+static void _etag_set(const char *name, uint32_t etag, uint32_t size)
+{
+    _etag_entry_t *entry = &_etags[0];
+
+    if (*name == '\0') {
+        return;
+    }
+
+    mutex_lock(&_file_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_etags); i++) {
+        if (!strcmp(_etags[i].name, name)) {
+            entry = &_etags[i];
+            break;
+        }
+        /* unused entries have last_used 0, so they are picked first */
+        if (_etags[i].last_used < entry->last_used) {
+            entry = &_etags[i];
+        }
+    }
+    strcpy(entry->name, name);
+    entry->etag = etag;
+    entry->size = size;
+    entry->last_used = ++_uses;
+    mutex_unlock(&_file_mtx);
+}
+
+static void _etag_drop(const char *path)
+{
+    mutex_lock(&_file_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_etags); i++) {
+        if (_etags[i].name[0] && _path_affected(_etags[i].name, path)) {
+            memset(&_etags[i], 0, sizeof(_etags[i]));
+        }
+    }
+    mutex_unlock(&_file_mtx);
+}
+#else
+static inline bool _etag_get(const char *name, uint32_t *etag, uint32_t *size)
+{
+    (void)name;
+    (void)etag;
+    (void)size;
+    return false;
+}
+
+static inline void _etag_set(const char *name, uint32_t etag, uint32_t size)
+{
+    (void)name;
+    (void)etag;
+    (void)size;
+}
+
+static inline void _etag_drop(const char *path)
+{
+    (void)path;
+}
+#endif
+
+static void _file_close(_file_t *file)
+{
+    if (file->open) {
+        vfs_close(file->fd);
+        file->open = false;
+    }
+}
+
+static void _files_close(const char *path)
+{
+    mutex_lock(&_file_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if (_path_affected(_files[i].name, path)) {
+            _file_close(&_files[i]);
+        }
+    }
+    mutex_unlock(&_file_mtx);
+}
+
+static bool _file_of(const _file_t *file, const sock_udp_ep_t *remote)
+{
+    return file->open && remote && sock_udp_ep_equal(&file->remote, remote);
+}
+
+/* picks the file kept open for the client, in this order: the same file
+ * already opened by the client, the slot of a client that moved on to another
+ * file, a free slot, the same file opened by another client and the least
+ * recently used slot */
+static _file_t *_file_pick(const char *name, uint32_t etag,
+                           const sock_udp_ep_t *remote)
+{
+    _file_t *own = NULL;
+    _file_t *unused = NULL;
+    _file_t *shared = NULL;
+    _file_t *lru = &_files[0];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        _file_t *file = &_files[i];
+        bool same = file->open && (file->etag == etag) && !strcmp(file->name, name);
+
+        if (_file_of(file, remote)) {
+            if (same) {
+                return file;
+            }
+            own = file;
+        }
+        else if (!file->open) {
+            unused = file;
+        }
+        else if (same) {
+            shared = file;
+        }
+        if (file->last_used < lru->last_used) {
+            lru = file;
+        }
+    }
+
+    if (own) {
+        return own;
+    }
+    if (unused) {
+        return unused;
+    }
+    return shared ? shared : lru;
+}
+
+static int _file_open(_file_t **result, const char *name, uint32_t etag,
+                      const sock_udp_ep_t *remote)
+{
+    _file_t *file = _file_pick(name, etag, remote);
+
+    file->last_used = ++_uses;
+    *result = file;
+    if (file->open && (file->etag == etag) && !strcmp(file->name, name)) {
+        return 0;
+    }
+    _file_close(file);
+
+    int fd = vfs_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return fd;
+    }
+    strcpy(file->name, name);
+    if (remote) {
+        file->remote = *remote;
+    }
+    else {
+        memset(&file->remote, 0, sizeof(file->remote));
+    }
+    file->etag = etag;
+    file->pos = 0;
+    file->fd = fd;
+    file->open = true;
+#if CONFIG_NANOCOAP_FILESERVER_READ_AHEAD
+    file->ra_len = 0;
+#endif
+    return 0;
+}
+
+static int _file_read_at(_file_t *file, void *dst, off_t offset, size_t len)
+{
+    if (file->pos != offset) {
+        int res = vfs_lseek(file->fd, offset, SEEK_SET);
+        if (res < 0) {
+            return res;
+        }
+        file->pos = offset;
+    }
+
+    int read = vfs_read(file->fd, dst, len);
+    if (read > 0) {
+        file->pos += read;
+    }
+    return read;
+}
+
+static int _file_read(_file_t *file, void *dst, off_t offset, size_t len)
+{
+#if CONFIG_NANOCOAP_FILESERVER_READ_AHEAD
+    if (len <= sizeof(file->ra_buf)) {
+        if ((offset < file->ra_start) ||
+            (offset + len > file->ra_start + file->ra_len)) {
+            int read = _file_read_at(file, file->ra_buf, offset, sizeof(file->ra_buf));
+            if (read < 0) {
+                file->ra_len = 0;
+                return read;
+            }
+            file->ra_start = offset;
+            file->ra_len = read;
+        }
+        len = MIN(len, file->ra_start + file->ra_len - offset);
+        memcpy(dst, &file->ra_buf[offset - file->ra_start], len);
+        return len;
+    }
+#endif
+    return _file_read_at(file, dst, offset, len);
+}
+
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_PUT) || IS_USED(MODULE_NANOCOAP_FILESERVER_DELETE)
+/* answers a conditional request on a file in the ETag cache without touching
+ * the VFS, returns true if the precondition failed */
+static bool _cached_precondition_failed(coap_pkt_t *pdu,
+                                        const struct requestdata *request)
+{
+    uint32_t etag;
+
+    if (!_etag_get(request->namebuf, &etag, NULL)) {
+        return false;
+    }
+    if (request->options.exists.if_match &&
+        memcmp(&etag, &request->options.if_match, request->options.if_match_len)) {
+        return true;
+    }
+    if (request->options.exists.if_none_match &&
+        (coap_get_method(pdu) == COAP_METHOD_PUT)) {
+        /* the file exists, If-None-Match only applies to the first block */
+        coap_block1_t block1 = { 0 };
+        return !request->options.exists.block1 ||
+               ((coap_get_block1(pdu, &block1) > 0) && (block1.blknum == 0));
+    }
+    return false;
+}
+#endif
+
 static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                          struct requestdata *request)
 {
@@ -210,13 +516,14 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     uint32_t etag, size_total;
 
     coap_block1_t block2 = { .szx = CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX };
-    {
+    if (!_etag_get(request->namebuf, &etag, &size_total)) {
         struct stat stat;
         if ((err = vfs_stat(request->namebuf, &stat)) < 0) {
             return _error_handler(pdu, buf, len, err);
         }
         size_total = stat.st_size;
         stat_etag(&stat, &etag);
+        _etag_set(request->namebuf, etag, size_total);
     }
     if (request->options.exists.block2 && !coap_get_block2(pdu, &block2)) {
         return _error_handler(pdu, buf, len, COAP_CODE_BAD_OPTION);
@@ -232,9 +539,11 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
     }
 
-    int fd = vfs_open(request->namebuf, O_RDONLY, 0);
-    if (fd < 0) {
-        return _error_handler(pdu, buf, len, fd);
+    _file_t *file;
+    mutex_lock(&_file_mtx);
+    if ((err = _file_open(&file, request->namebuf, etag, request->remote)) < 0) {
+        mutex_unlock(&_file_mtx);
+        return _error_handler(pdu, buf, len, err);
     }
 
     _resp_init(pdu, buf, len, COAP_CODE_CONTENT);
@@ -252,11 +561,6 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
 
-    err = vfs_lseek(fd, slicer.start, SEEK_SET);
-    if (err < 0) {
-        goto late_err;
-    }
-
     if (block2.blknum == 0) {
         _event_file(NANOCOAP_FILESERVER_GET_FILE_START, request);
     }
@@ -268,15 +572,18 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * space by CONFIG_GCOAP_RESP_OPTIONS_BUF
      * */
     assert(pdu->payload + slicer.end - slicer.start <= buf + len);
-    bool more = 1;
-    int read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    size_t want = (slicer.start < size_total)
+                ? MIN(slicer.end, size_total) - slicer.start : 0;
+    int read = want ? _file_read(file, pdu->payload, slicer.start, want) : 0;
     if (read < 0) {
         goto late_err;
     }
-    more = (unsigned)read > slicer.end - slicer.start;
-    read -= more;
+    bool more = ((unsigned)read == want) && (slicer.start + read < size_total);
 
-    vfs_close(fd);
+    if (!more) {
+        _file_close(file);
+    }
+    mutex_unlock(&_file_mtx);
 
     slicer.cur = slicer.end + more;
     coap_block2_finish(&slicer);
@@ -293,7 +600,8 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return resp_len + read;
 
 late_err:
-    vfs_close(fd);
+    _file_close(file);
+    mutex_unlock(&_file_mtx);
     coap_pkt_set_code(pdu, COAP_CODE_INTERNAL_SERVER_ERROR);
     return coap_get_total_hdr_len(pdu);
 }
@@ -306,6 +614,10 @@ static ssize_t _put_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     uint32_t etag;
     struct stat stat;
     coap_block1_t block1 = {0};
+    if (_cached_precondition_failed(pdu, request)) {
+        return _error_handler(pdu, buf, len, COAP_CODE_PRECONDITION_FAILED);
+    }
+    _etag_drop(request->namebuf);
     bool create = (vfs_stat(request->namebuf, &stat) == -ENOENT);
     if (create) {
         /* While a file 'f' is initially being created,
@@ -394,6 +706,11 @@ static ssize_t _put_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         _event_file(NANOCOAP_FILESERVER_PUT_FILE_END, request);
 
         stat_etag(&stat, &etag); /* Etag after write */
+        if (!create) {
+            /* renaming may change the stat of a new file, so only cache
+             * files modified in place */
+            _etag_set(request->namebuf, etag, stat.st_size);
+        }
         _resp_init(pdu, buf, len, create ? COAP_CODE_CREATED : COAP_CODE_CHANGED);
         coap_opt_add_opaque(pdu, COAP_OPT_ETAG, &etag, sizeof(etag));
     }
@@ -421,6 +738,10 @@ static ssize_t _delete_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     int ret;
     uint32_t etag;
     struct stat stat;
+    if (_cached_precondition_failed(pdu, request)) {
+        return _error_handler(pdu, buf, len, COAP_CODE_PRECONDITION_FAILED);
+    }
+    _etag_drop(request->namebuf);
     if ((ret = vfs_stat(request->namebuf, &stat)) < 0) {
         return _error_handler(pdu, buf, len, ret);
     }
@@ -554,6 +875,7 @@ static ssize_t _delete_directory(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  struct requestdata *request)
 {
     int err;
+    _etag_drop(request->namebuf);
     if (request->options.exists.if_match && request->options.if_match_len) {
         if (request->options.if_match != byteorder_htonl(COAPFILESERVER_DIR_DELETE_ETAG).u32) {
             return _error_handler(pdu, buf, len, COAP_CODE_PRECONDITION_FAILED);
@@ -598,7 +920,7 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  coap_request_ctx_t *ctx) {
     const char *root = coap_request_ctx_get_context(ctx);
     const char *resource = coap_request_ctx_get_path(ctx);
-    struct requestdata request = {0};
+    struct requestdata request = { .remote = coap_request_ctx_get_remote_udp(ctx) };
 
     /** Index in request.namebuf. Must not point at the last entry as that will be
      * zeroed to get a 0-terminated string. */
@@ -723,6 +1045,11 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     DEBUG("request: '%s'\n", request.namebuf);
 
+    if (coap_get_method(pdu) != COAP_METHOD_GET) {
+        /* don't keep files open that are about to be modified */
+        _files_close(request.namebuf);
+    }
+
     /* Note to self: As we parse more options than just Uri-Path, we'll likely
      * pass a struct pointer later. So far, those could even be hooked into the
      * resource list, but that'll go away once we parse more options */
@@ -737,6 +1064,17 @@ error:
     return 0;
 }
 
+void nanocoap_fileserver_release_files(void)
+{
+    _files_close(NULL);
+}
+
+void nanocoap_fileserver_invalidate(const char *path)
+{
+    _files_close(path);
+    _etag_drop(path);
+}
+
 #ifdef MODULE_NANOCOAP_FILESERVER_CALLBACK
 void nanocoap_fileserver_set_event_cb(nanocoap_fileserver_event_handler_t cb, void *ctx)
 {
@@ -29,6 +29,10 @@
 #include "bitarithm.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap_sock.h"
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+#include "mutex.h"
+#include "net/nanocoap/path_index.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -538,6 +542,48 @@ bool coap_has_unprocessed_critical_options(const coap_pkt_t *pkt)
     return false;
 }
 
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+static ssize_t _indexed_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                     unsigned resp_buf_len,
+                                     coap_request_ctx_t *ctx)
+{
+    static coap_path_index_t index;
+    static uint32_t slots[CONFIG_NANOCOAP_PATH_INDEX_SLOTS];
+    static mutex_t lock = MUTEX_INIT;
+    static int state = -EAGAIN;
+
+    if (state == -EAGAIN) {
+        /* build the index on the first request, there may be more than one
+         * server thread */
+        mutex_lock(&lock);
+        if (state == -EAGAIN) {
+            state = coap_path_index_init(&index, coap_resources,
+                                         coap_resources_numof,
+                                         slots, CONFIG_NANOCOAP_PATH_INDEX_SLOTS);
+        }
+        mutex_unlock(&lock);
+    }
+    if (state != 0) {
+        return coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
+                                 coap_resources, coap_resources_numof);
+    }
+
+    const coap_resource_t *resource;
+    int res = coap_path_index_find(&index, pkt,
+                                   coap_method2flag(coap_get_code_detail(pkt)),
+                                   &resource);
+    if (res == -EBADMSG) {
+        return -EBADMSG;
+    }
+    if (res != 0) {
+        return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+    }
+
+    ctx->resource = resource;
+    return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+}
+#endif
+
 ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_len,
                         coap_request_ctx_t *ctx)
 {
@@ -571,8 +617,12 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
         }
     }
 
+#if IS_USED(MODULE_NANOCOAP_PATH_INDEX)
+    ssize_t retval = _indexed_tree_handler(pkt, resp_buf, resp_buf_len, ctx);
+#else
     ssize_t retval = coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
                                        coap_resources, coap_resources_numof);
+#endif
 
     if (retval < 0) {
         if (retval == -ECANCELED) {
@@ -724,6 +774,87 @@ ssize_t coap_reply_simple(coap_pkt_t *pkt,
     return header_len + payload_len;
 }
 
+int coap_static_response_init(coap_static_response_t *resp,
+                              const coap_pkt_t *pkt, size_t len)
+{
+    unsigned hdr_len = coap_get_total_hdr_len(pkt);
+    size_t opts_len = len - hdr_len;
+    size_t body_len = len - hdr_len;
+    uint8_t *etag;
+    ssize_t etag_len;
+
+    if (coap_get_token_len(pkt) || (len < hdr_len) || (len > UINT16_MAX)) {
+        return -EINVAL;
+    }
+    if (pkt->payload_len) {
+        /* the options end at the payload marker */
+        opts_len = pkt->payload - pkt->buf - hdr_len - 1;
+        if (pkt->payload >= pkt->buf + len) {
+            /* no payload after all, drop the marker */
+            body_len = opts_len;
+        }
+    }
+
+    etag_len = coap_opt_get_opaque((coap_pkt_t *)pkt, COAP_OPT_ETAG, &etag);
+    if ((etag_len <= 0) || (etag_len > COAP_ETAG_LENGTH_MAX)) {
+        etag = NULL;
+        etag_len = 0;
+    }
+
+    *resp = (coap_static_response_t){
+        .opts = pkt->buf + hdr_len,
+        .opts_len = opts_len,
+        .len = body_len,
+        .etag = etag,
+        .etag_len = etag_len,
+        .code = coap_get_code_raw(pkt),
+    };
+    return 0;
+}
+
+static bool _etag_matches(coap_pkt_t *pkt, const coap_static_response_t *resp)
+{
+    uint8_t *opt_pos = NULL;
+    uint8_t *etag;
+    int etag_len;
+
+    /* a request may carry several ETags */
+    while ((etag = coap_iterate_option(pkt, COAP_OPT_ETAG, &opt_pos,
+                                       &etag_len))) {
+        if ((etag_len == resp->etag_len) &&
+            !memcmp(etag, resp->etag, etag_len)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ssize_t coap_static_response_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                                     coap_request_ctx_t *context)
+{
+    const coap_static_response_t *resp = coap_request_ctx_get_context(context);
+    unsigned code = resp->code;
+    size_t body_len = resp->len;
+
+    /* the request may be stored in buf, so check it before replying */
+    if (resp->etag_len && _etag_matches(pkt, resp)) {
+        code = COAP_CODE_VALID;
+        body_len = resp->opts_len;
+    }
+
+    ssize_t hdr_len = coap_build_reply_header(pkt, code, buf, len,
+                                              COAP_FORMAT_NONE, NULL, NULL);
+    if (hdr_len < 0) {
+        return hdr_len;
+    }
+    if ((size_t)hdr_len + body_len > len) {
+        return -ENOBUFS;
+    }
+
+    memcpy(buf + hdr_len, resp->opts, body_len);
+    return hdr_len + body_len;
+}
+
 ssize_t coap_build_empty_ack(const coap_pkt_t *pkt, coap_udp_hdr_t *ack)
 {
     if (coap_get_type(pkt) != COAP_TYPE_CON) {
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_nanocoap_path_index
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource path index implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+
+#include "net/nanocoap/path_index.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* FNV-1a */
+#define HASH_BASIS          (2166136261U)
+#define HASH_PRIME          (16777619U)
+
+/* a slot holds the upper half of the path hash, a flag for subtree
+ * resources and the index of the resource + 1, so 0 marks an empty slot */
+#define SLOT_TAG_MASK       (0xffff0000U)
+#define SLOT_SUBTREE        (0x8000U)
+#define SLOT_IDX_MASK       (0x7fffU)
+
+typedef struct {
+    const coap_path_index_t *index;
+    coap_pkt_t *pkt;
+    coap_method_flags_t method;
+    uint32_t hash;              /* hash of the Uri-Path bytes walked so far */
+    size_t len;                 /* number of Uri-Path bytes walked so far */
+    unsigned best;              /* lowest matching resource index */
+    bool wrong_method;          /* a resource matched the path only */
+} _lookup_t;
+
+static inline uint32_t _len_bit(size_t len)
+{
+    return 1LU << (len < 31 ? len : 31);
+}
+
+static inline uint32_t _hash(uint32_t hash, uint8_t c)
+{
+    return (hash ^ c) * HASH_PRIME;
+}
+
+/* compares the Uri-Path of the request, as in "/seg1/seg2", to path without
+ * copying the options, if prefix is set path only needs to match the start */
+static bool _path_equals(coap_pkt_t *pkt, const char *path, bool prefix)
+{
+    size_t len = strlen(path);
+    uint8_t *opt_pos = NULL;
+    uint8_t *seg;
+    int seg_len;
+
+    while ((seg = coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos,
+                                      &seg_len))) {
+        if (len == 0) {
+            return prefix;
+        }
+        if (*path != '/') {
+            return false;
+        }
+        path++;
+        len--;
+        if ((size_t)seg_len > len) {
+            return prefix && !memcmp(path, seg, len);
+        }
+        if (memcmp(path, seg, seg_len)) {
+            return false;
+        }
+        path += seg_len;
+        len -= seg_len;
+    }
+    if (opt_pos == NULL) {
+        /* no Uri-Path option, this is a request for "/" */
+        return (len == 0) ? prefix : ((*path == '/') && (len == 1));
+    }
+    return len == 0;
+}
+
+static void _check_candidates(_lookup_t *lookup, bool subtree)
+{
+    const coap_path_index_t *index = lookup->index;
+
+    for (unsigned pos = lookup->hash & index->mask; index->slots[pos];
+         pos = (pos + 1) & index->mask) {
+        uint32_t slot = index->slots[pos];
+
+        if (((slot ^ lookup->hash) & SLOT_TAG_MASK) ||
+            (!(slot & SLOT_SUBTREE) != !subtree)) {
+            continue;
+        }
+
+        unsigned i = (slot & SLOT_IDX_MASK) - 1;
+        if (i >= lookup->best) {
+            /* an earlier resource already matched */
+            continue;
+        }
+
+        const coap_resource_t *resource = &index->resources[i];
+        if (!_path_equals(lookup->pkt, resource->path, subtree)) {
+            continue;
+        }
+        if (resource->methods & lookup->method) {
+            lookup->best = i;
+        }
+        else {
+            lookup->wrong_method = true;
+        }
+    }
+}
+
+static void _walk(_lookup_t *lookup, const uint8_t *data, size_t len)
+{
+    while (len--) {
+        lookup->hash = _hash(lookup->hash, *data++);
+        lookup->len++;
+        if (lookup->index->subtree_lens & _len_bit(lookup->len)) {
+            _check_candidates(lookup, true);
+        }
+    }
+}
+
+int coap_path_index_init(coap_path_index_t *index,
+                         const coap_resource_t *resources,
+                         size_t resources_numof,
+                         uint32_t *slots, size_t slots_numof)
+{
+    assert(slots_numof && !(slots_numof & (slots_numof - 1)) &&
+           (slots_numof <= 0x10000));
+
+    if ((resources_numof > COAP_PATH_INDEX_RESOURCES_MAX) ||
+        (resources_numof > (slots_numof / 4) * 3)) {
+        DEBUG("nanocoap: %u resources don't fit %u index slots\n",
+              (unsigned)resources_numof, (unsigned)slots_numof);
+        return -ENOSPC;
+    }
+
+    *index = (coap_path_index_t){
+        .resources = resources,
+        .slots = slots,
+        .mask = slots_numof - 1,
+    };
+    memset(slots, 0, slots_numof * sizeof(*slots));
+
+    for (unsigned i = 0; i < resources_numof; i++) {
+        const char *path = resources[i].path;
+        uint32_t hash = HASH_BASIS;
+        uint32_t slot = i + 1;
+        size_t len = strlen(path);
+
+        for (size_t j = 0; j < len; j++) {
+            hash = _hash(hash, path[j]);
+        }
+        if (resources[i].methods & COAP_MATCH_SUBTREE) {
+            index->subtree_lens |= _len_bit(len);
+            slot |= SLOT_SUBTREE;
+        }
+
+        unsigned pos = hash & index->mask;
+        while (slots[pos]) {
+            pos = (pos + 1) & index->mask;
+        }
+        slots[pos] = (hash & SLOT_TAG_MASK) | slot;
+    }
+
+    return 0;
+}
+
+int coap_path_index_find(const coap_path_index_t *index, coap_pkt_t *pkt,
+                         coap_method_flags_t method,
+                         const coap_resource_t **resource)
+{
+    _lookup_t lookup = {
+        .index = index,
+        .pkt = pkt,
+        .method = method,
+        .hash = HASH_BASIS,
+        .best = UINT_MAX,
+    };
+    uint8_t *opt_pos = NULL;
+    uint8_t *seg;
+    int seg_len;
+
+    if (index->subtree_lens & _len_bit(0)) {
+        _check_candidates(&lookup, true);
+    }
+    while ((seg = coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos,
+                                      &seg_len))) {
+        _walk(&lookup, (const uint8_t *)"/", 1);
+        _walk(&lookup, seg, seg_len);
+    }
+    if (opt_pos == NULL) {
+        /* no Uri-Path option, this is a request for "/" */
+        _walk(&lookup, (const uint8_t *)"/", 1);
+    }
+    if (lookup.len >= CONFIG_NANOCOAP_URI_MAX) {
+        /* the linear search does not match paths that don't fit its buffer */
+        return -EBADMSG;
+    }
+    _check_candidates(&lookup, false);
+
+    if (lookup.best != UINT_MAX) {
+        *resource = &index->resources[lookup.best];
+        return 0;
+    }
+    return lookup.wrong_method ? -EPERM : -ENOENT;
+}
@@ -917,6 +917,351 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
     return 0;
 }
 
+static_assert(CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX > 0 &&
+              CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX <= 32,
+              "CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX must be in 1..32");
+
+typedef struct {
+    uint32_t blknum;
+    uint32_t deadline;          /* of the next retransmission in µs */
+    uint32_t timeout;           /* current retransmission timeout in µs */
+    uint16_t msg_id;
+    uint8_t tries_left;
+    bool in_use;
+} _window_slot_t;
+
+typedef struct {
+    nanocoap_sock_t *sock;
+    const char *path;
+    coap_blockwise_cb_t callback;
+    void *arg;
+    uint8_t *buf;               /* blocks received out of order */
+    size_t buf_len;
+    uint32_t next;              /* next block to pass to the callback */
+    uint32_t requested;         /* next block to request */
+    uint32_t last;              /* last block, UINT32_MAX while unknown */
+    uint32_t err_blknum;        /* first block the server failed to serve */
+    uint32_t received;          /* bit n: block next + n is in buf */
+    uint32_t token;             /* token of block 0, block n uses token + n */
+    int err;                    /* error returned for err_blknum */
+    size_t last_len;            /* payload length of the last block */
+    coap_blksize_t blksize;
+    uint8_t window;             /* blocks allowed in flight */
+    uint8_t window_max;
+    uint8_t delivered;          /* blocks delivered since the window grew */
+    _window_slot_t slots[CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX];
+} _window_ctx_t;
+
+static void _window_set_blksize(_window_ctx_t *ctx, coap_blksize_t blksize)
+{
+    size_t blocks = ctx->buf_len / coap_szx2size(blksize);
+
+    ctx->blksize = blksize;
+    ctx->window_max = MIN(blocks + 1, CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX);
+}
+
+static uint8_t *_window_buf(_window_ctx_t *ctx, uint32_t blknum)
+{
+    /* the blocks after next that may be in flight have distinct positions */
+    return ctx->buf + (blknum % (ctx->window_max - 1)) * coap_szx2size(ctx->blksize);
+}
+
+static int _window_send(_window_ctx_t *ctx, _window_slot_t *slot)
+{
+    nanocoap_sock_t *sock = ctx->sock;
+    uint8_t *buf = sock->hdr_buf;
+    uint32_t token = ctx->token + slot->blknum;
+    uint16_t lastonum = 0;
+
+    ssize_t hdr_len = coap_build_udp_hdr(buf, sizeof(sock->hdr_buf), COAP_TYPE_CON,
+                                         &token, sizeof(token), COAP_METHOD_GET,
+                                         slot->msg_id);
+    assume(hdr_len > 0);
+    buf += hdr_len;
+    buf += coap_opt_put_uri_pathquery(buf, &lastonum, ctx->path);
+    buf += coap_opt_put_uint(buf, lastonum, COAP_OPT_BLOCK2,
+                             (slot->blknum << 4) | ctx->blksize);
+    if (slot->blknum == 0) {
+        /* ask for the total size */
+        buf += coap_opt_put_uint(buf, COAP_OPT_BLOCK2, COAP_OPT_SIZE2, 0);
+    }
+    assume((uintptr_t)buf - (uintptr_t)sock->hdr_buf < sizeof(sock->hdr_buf));
+
+    const iolist_t snip = {
+        .iol_base = sock->hdr_buf,
+        .iol_len  = (uintptr_t)buf - (uintptr_t)sock->hdr_buf,
+    };
+
+    DEBUG("nanocoap: request block %"PRIu32" (%u tries left)\n",
+          slot->blknum, slot->tries_left);
+    return _sock_sendv(sock, &snip);
+}
+
+static int _window_fill(_window_ctx_t *ctx)
+{
+    unsigned in_flight = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->slots); i++) {
+        in_flight += ctx->slots[i].in_use;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->slots) && in_flight < ctx->window; i++) {
+        _window_slot_t *slot = &ctx->slots[i];
+        uint32_t blknum = ctx->requested;
+
+        if ((blknum > ctx->last) || (blknum >= ctx->err_blknum) ||
+            (blknum - ctx->next >= ctx->window_max) ||
+            ((blknum > 0) && (ctx->next == 0))) {
+            /* end reached, out of buffer space or waiting for the first
+             * block to learn the block size */
+            break;
+        }
+        if (slot->in_use) {
+            continue;
+        }
+
+        slot->blknum = blknum;
+        slot->msg_id = nanocoap_sock_next_msg_id(ctx->sock);
+        slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT;
+        slot->timeout = random_uint32_range((uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * US_PER_MS,
+                                            (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS *
+                                            CONFIG_COAP_RANDOM_FACTOR_1000);
+        slot->deadline = _deadline_from_interval(slot->timeout);
+        slot->in_use = true;
+
+        int res = _window_send(ctx, slot);
+        if (res < 0) {
+            return res;
+        }
+        ctx->requested++;
+        in_flight++;
+    }
+
+    return 0;
+}
+
+static int _window_retransmit(_window_ctx_t *ctx, uint32_t *timeout)
+{
+    *timeout = UINT32_MAX;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->slots); i++) {
+        _window_slot_t *slot = &ctx->slots[i];
+
+        if (!slot->in_use) {
+            continue;
+        }
+        if (_deadline_left_us(slot->deadline) == 0) {
+            if (slot->tries_left == 0) {
+                DEBUG("nanocoap: block %"PRIu32" timed out\n", slot->blknum);
+                return -ETIMEDOUT;
+            }
+            slot->tries_left--;
+            slot->timeout *= 2;
+            slot->deadline = _deadline_from_interval(slot->timeout);
+
+            /* back off */
+            ctx->window = MAX(ctx->window / 2, 1);
+            ctx->delivered = 0;
+
+            int res = _window_send(ctx, slot);
+            if (res < 0) {
+                return res;
+            }
+        }
+        *timeout = MIN(*timeout, _deadline_left_us(slot->deadline));
+    }
+
+    return 0;
+}
+
+static int _window_deliver(_window_ctx_t *ctx, uint8_t *data, size_t len)
+{
+    size_t blksize = coap_szx2size(ctx->blksize);
+    bool more = ctx->next != ctx->last;
+
+    int res = ctx->callback(ctx->arg, ctx->next * blksize, data, len, more);
+    if (res < 0) {
+        return res;
+    }
+
+    ctx->next++;
+    ctx->received >>= 1;
+    if (++ctx->delivered >= ctx->window && ctx->window < ctx->window_max) {
+        ctx->window++;
+        ctx->delivered = 0;
+    }
+    return 0;
+}
+
+static _window_slot_t *_window_match(_window_ctx_t *ctx, coap_pkt_t *pkt)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->slots); i++) {
+        _window_slot_t *slot = &ctx->slots[i];
+        uint32_t token = ctx->token + slot->blknum;
+
+        if (slot->in_use &&
+            !_id_or_token_missmatch(pkt, slot->msg_id, &token, sizeof(token))) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static int _window_handle(_window_ctx_t *ctx, uint8_t *data, size_t len)
+{
+    coap_pkt_t pkt;
+
+    if (coap_parse_udp(&pkt, data, len) < 0) {
+        DEBUG("nanocoap: error parsing packet\n");
+        return 0;
+    }
+
+    _window_slot_t *slot = _window_match(ctx, &pkt);
+    if (slot == NULL) {
+        DEBUG("nanocoap: unexpected response\n");
+        return 0;
+    }
+
+    switch (coap_get_type(&pkt)) {
+    case COAP_TYPE_RST:
+        return -EBADMSG;
+    case COAP_TYPE_ACK:
+        if (coap_get_code_raw(&pkt) == COAP_CODE_EMPTY) {
+            /* empty ACK, wait for separate response */
+            slot->deadline = _deadline_from_interval(CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS
+                                                     * US_PER_MS);
+            slot->tries_left = 0;
+            return 0;
+        }
+        break;
+    case COAP_TYPE_CON:
+        _send_ack(ctx->sock, &pkt);
+        break;
+    default:
+        break;
+    }
+
+    uint32_t blknum = slot->blknum;
+    slot->in_use = false;
+
+    int res = _get_error(&pkt);
+    if (res) {
+        /* only an error if the block turns out to be part of the resource */
+        if (blknum < ctx->err_blknum) {
+            ctx->err_blknum = blknum;
+            ctx->err = res;
+        }
+        return 0;
+    }
+
+    coap_block1_t block2;
+    if (!coap_get_block2(&pkt, &block2)) {
+        /* response was not block-wise */
+        block2.blknum = 0;
+        block2.szx = ctx->blksize;
+        block2.more = false;
+    }
+
+    if (blknum == 0 && block2.szx < ctx->blksize && block2.blknum == 0) {
+        /* the server chose a smaller block size */
+        _window_set_blksize(ctx, block2.szx);
+    }
+    if (block2.blknum != blknum || block2.szx != ctx->blksize) {
+        DEBUG("nanocoap: got block %"PRIu32", want %"PRIu32"\n", block2.blknum, blknum);
+        return -EBADMSG;
+    }
+
+    uint32_t size2;
+    if (blknum == 0 && !coap_opt_get_uint(&pkt, COAP_OPT_SIZE2, &size2)) {
+        ctx->last = size2 ? (size2 - 1) >> (ctx->blksize + 4) : 0;
+    }
+    if (!block2.more) {
+        ctx->last = MIN(ctx->last, blknum);
+    }
+    if (blknum > ctx->last || blknum < ctx->next) {
+        /* beyond the end or duplicate */
+        return 0;
+    }
+    if (block2.more && pkt.payload_len != coap_szx2size(ctx->blksize)) {
+        return -EBADMSG;
+    }
+
+    DEBUG("nanocoap: got block %"PRIu32"\n", blknum);
+    if (blknum != ctx->next) {
+        memcpy(_window_buf(ctx, blknum), pkt.payload, pkt.payload_len);
+        ctx->received |= 1UL << (blknum - ctx->next);
+        if (blknum == ctx->last) {
+            ctx->last_len = pkt.payload_len;
+        }
+        return 0;
+    }
+
+    res = _window_deliver(ctx, pkt.payload, pkt.payload_len);
+    while (res == 0 && (ctx->received & 1)) {
+        size_t blk_len = (ctx->next == ctx->last) ? ctx->last_len
+                                                  : coap_szx2size(ctx->blksize);
+        res = _window_deliver(ctx, _window_buf(ctx, ctx->next), blk_len);
+    }
+    return res;
+}
+
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize,
+                                       void *buf, size_t len,
+                                       coap_blockwise_cb_t callback, void *arg)
+{
+    _window_ctx_t ctx = {
+        .sock = sock,
+        .path = path,
+        .callback = callback,
+        .arg = arg,
+        .buf = buf,
+        .buf_len = len,
+        .last = UINT32_MAX,
+        .err_blknum = UINT32_MAX,
+        .token = random_uint32(),
+        .window = 1,
+    };
+    int res = 0;
+
+    _window_set_blksize(&ctx, blksize);
+
+    /* clear out stale responses from previous requests */
+    _sock_flush(sock);
+
+    while (ctx.next <= ctx.last) {
+        uint32_t timeout;
+
+        if (ctx.next >= ctx.err_blknum) {
+            res = ctx.err;
+            break;
+        }
+        if ((res = _window_fill(&ctx)) < 0 ||
+            (res = _window_retransmit(&ctx, &timeout)) < 0) {
+            break;
+        }
+
+        void *payload, *buf_ctx = NULL;
+        res = _sock_recv_buf(sock, &payload, &buf_ctx, timeout);
+        if (res > 0) {
+            res = _window_handle(&ctx, payload, res);
+        }
+        while (buf_ctx) {
+            _sock_recv_buf(sock, &payload, &buf_ctx, 0);
+        }
+        if (res == -ETIMEDOUT) {
+            /* handled by _window_retransmit() */
+            res = 0;
+        }
+        if (res < 0) {
+            break;
+        }
+    }
+
+    DEBUG("nanocoap: windowed transfer done at block %"PRIu32": %d\n", ctx.next, res);
+    return res < 0 ? res : 0;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
@@ -1096,6 +1441,24 @@ int nanocoap_get_blockwise_url(const char *url,
     return res;
 }
 
+int nanocoap_get_blockwise_window_url(const char *url,
+                                      coap_blksize_t blksize,
+                                      void *buf, size_t len,
+                                      coap_blockwise_cb_t callback, void *arg)
+{
+    nanocoap_sock_t sock;
+    int res = nanocoap_sock_url_connect(url, &sock);
+    if (res) {
+        return res;
+    }
+
+    res = nanocoap_sock_get_blockwise_window(&sock, sock_urlpath(url), blksize,
+                                             buf, len, callback, arg);
+    nanocoap_sock_close(&sock);
+
+    return res;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
@@ -115,10 +115,17 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
         }
 
         uint32_t ttl;
-        if ((res = dns_msg_parse_reply(dns_buf, res, family,
+        size_t len = res;
+        if ((res = dns_msg_parse_reply(dns_buf, len, family,
                                        addr_out, &ttl)) > 0) {
             dns_cache_add(domain_name, addr_out, res, ttl);
             break;
+        } else if (dns_msg_reply_is_negative(dns_buf, len)) {
+            DEBUG("sock_dns: %s has no address\n", domain_name);
+            dns_cache_add_negative(domain_name, family,
+                                   CONFIG_DNS_CACHE_NEGATIVE_TTL);
+            res = -ENOENT;
+            break;
         } else {
             DEBUG("sock_dns: can't parse response\n");
         }
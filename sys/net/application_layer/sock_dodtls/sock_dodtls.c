@@ -105,11 +105,19 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
             if (res > (int)SOCK_DODTLS_MIN_REPLY_LEN) {
                 uint32_t ttl = 0;
 
-                if ((res = dns_msg_parse_reply(_dns_buf, res, family,
+                size_t len = res;
+
+                if ((res = dns_msg_parse_reply(_dns_buf, len, family,
                                                addr_out, &ttl)) > 0) {
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (dns_msg_reply_is_negative(_dns_buf, len)) {
+                    dns_cache_add_negative(domain_name, family,
+                                           CONFIG_DNS_CACHE_NEGATIVE_TTL);
+                    res = -ENOENT;
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
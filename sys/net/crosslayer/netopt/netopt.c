@@ -140,6 +140,7 @@ static const char *_netopt_strmap[] = {
     [NETOPT_PAN_COORD]             = "NETOPT_PAN_COORD",
     [NETOPT_GTS_ALLOC]             = "NETOPT_GTS_ALLOC",
     [NETOPT_GTS_TX]                = "NETOPT_GTS_TX",
+    [NETOPT_TX_QUEUE_LEN]          = "NETOPT_TX_QUEUE_LEN",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
@@ -38,6 +38,7 @@
 #include "net/netstats/neighbor.h"
 #include "fmt.h"
 #include "log.h"
+#include "macros/utils.h"
 #include "sched.h"
 #if IS_USED(MODULE_ZTIMER)
 #include "ztimer.h"
@@ -209,6 +210,15 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                        sizeof(netif->stats));
                 res = sizeof(netif->stats);
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_PKTQ) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+            case NETSTATS_PKTQ:
+                /* one netstats_pktq_t per class of packets */
+                assert(opt->data_len == sizeof(netif->send_queue.stats));
+                memcpy(opt->data, netif->send_queue.stats,
+                       sizeof(netif->send_queue.stats));
+                res = sizeof(netif->send_queue.stats);
+                break;
 #endif
             default:
                 /* take from device */
@@ -473,6 +483,19 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 memset(&netif->stats, 0, sizeof(netif->stats));
                 res = 0;
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_PKTQ) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+            case NETSTATS_PKTQ:
+                for (unsigned i = 0; i < GNRC_NETIF_PKTQ_CLASS_NUMOF; i++) {
+                    netstats_pktq_t *stats = &netif->send_queue.stats[i];
+
+                    /* packets still queued stay accounted for */
+                    stats->enqueued = 0;
+                    stats->dropped = 0;
+                    stats->len_max = stats->len;
+                }
+                res = 0;
+                break;
 #endif
             default:
                 /* take from device */
@@ -679,6 +702,10 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    /* the slot may have held another address with the same flags before */
+    gnrc_netif_ipv6_src_cache_flush(netif);
+    /* packets to this address must not be forwarded anymore */
+    gnrc_ipv6_fwd_cache_flush();
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -727,6 +754,8 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
             netif->ipv6.addrs_flags[i] = 0;
             ipv6_addr_set_unspecified(&netif->ipv6.addrs[i]);
+            gnrc_netif_ipv6_src_cache_flush(netif);
+            gnrc_ipv6_fwd_cache_flush();
         }
         else {
             ipv6_addr_t tmp;
@@ -770,6 +799,89 @@ int gnrc_netif_ipv6_addr_match(gnrc_netif_t *netif,
     return idx;
 }
 
+#if CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE > 0
+/**
+ * @brief   Looks up the source address cached for @p dst
+ *
+ * Flushes the cache first, if the addresses or their states changed or
+ * gnrc_netif_ipv6_src_cache_flush() was called since the last lookup.
+ *
+ * @pre the interface entry must be acquired
+ */
+static ipv6_addr_t *_src_cache_get(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                                   bool ll_only)
+{
+    gnrc_netif_ipv6_t *ipv6 = &netif->ipv6;
+    uint8_t gen = ipv6->src_cache_gen;
+
+    if ((gen != ipv6->src_cache_gen_seen) ||
+        (memcmp(ipv6->src_cache_flags, ipv6->addrs_flags,
+                sizeof(ipv6->addrs_flags)) != 0)) {
+        DEBUG("gnrc_netif: flush source address cache\n");
+        for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+            ipv6->src_cache[i].used = false;
+        }
+        memcpy(ipv6->src_cache_flags, ipv6->addrs_flags,
+               sizeof(ipv6->addrs_flags));
+        ipv6->src_cache_gen_seen = gen;
+        return NULL;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+        gnrc_netif_ipv6_src_cache_t *entry = &ipv6->src_cache[i];
+
+        if (entry->used && (entry->ll_only == ll_only) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return &ipv6->addrs[entry->idx];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief   Remembers @p src as source address for @p dst
+ *
+ * @pre the interface entry must be acquired
+ */
+static void _src_cache_set(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                           bool ll_only, const ipv6_addr_t *src)
+{
+    gnrc_netif_ipv6_t *ipv6 = &netif->ipv6;
+    gnrc_netif_ipv6_src_cache_t *entry;
+
+    /* flushed while the source was selected */
+    if (ipv6->src_cache_gen != ipv6->src_cache_gen_seen) {
+        return;
+    }
+    entry = &ipv6->src_cache[ipv6->src_cache_next];
+    if (++ipv6->src_cache_next >= CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE) {
+        ipv6->src_cache_next = 0;
+    }
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    entry->idx = src - ipv6->addrs;
+    entry->ll_only = ll_only;
+    entry->used = true;
+}
+#else
+static inline ipv6_addr_t *_src_cache_get(gnrc_netif_t *netif,
+                                          const ipv6_addr_t *dst,
+                                          bool ll_only)
+{
+    (void)netif;
+    (void)dst;
+    (void)ll_only;
+    return NULL;
+}
+
+static inline void _src_cache_set(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                                  bool ll_only, const ipv6_addr_t *src)
+{
+    (void)netif;
+    (void)dst;
+    (void)ll_only;
+    (void)src;
+}
+#endif
+
 ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
                                            const ipv6_addr_t *dst,
                                            bool ll_only)
@@ -781,8 +893,12 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
     assert((netif != NULL) && (dst != NULL));
     DEBUG("gnrc_netif: get best source address for %s\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
-    memset(candidate_set, 0, sizeof(candidate_set));
     gnrc_netif_acquire(netif);
+    if ((best_src = _src_cache_get(netif, dst, ll_only)) != NULL) {
+        gnrc_netif_release(netif);
+        return best_src;
+    }
+    memset(candidate_set, 0, sizeof(candidate_set));
     int first_candidate = _create_candidate_set(netif, dst, ll_only,
                                                 candidate_set);
     if (first_candidate >= 0) {
@@ -790,6 +906,7 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
         if (best_src == NULL) {
             best_src = &(netif->ipv6.addrs[first_candidate]);
         }
+        _src_cache_set(netif, dst, ll_only, best_src);
     }
     gnrc_netif_release(netif);
     return best_src;
@@ -1793,14 +1910,46 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
 }
 
+#if IS_USED(MODULE_NETDEV_NEW_API) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
+/**
+ * @brief   Checks if the device can't take another frame for transmission
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if all transmit slots of the device are taken
+ */
+static bool _tx_busy(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_NETDEV_NEW_API)
+    if (netif->tx_pkt == NULL) {
+        return false;
+    }
+#  if CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1
+    return netif->tx_queue_len >= netif->tx_queue_max;
+#  else
+    return true;
+#  endif
+#else
+    (void)netif;
+    return false;
+#endif
+}
+#endif
+
 static void _send_queued_pkt(gnrc_netif_t *netif)
 {
     (void)netif;
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     gnrc_pktsnip_t *pkt;
+    unsigned sent = 0;
 
-    if ((pkt = gnrc_netif_pktq_get(netif)) != NULL) {
+    /* fill all transmit slots of the device at once */
+    while ((sent < CONFIG_GNRC_NETIF_TX_QUEUE_LEN) && !_tx_busy(netif) &&
+           ((pkt = gnrc_netif_pktq_get(netif)) != NULL)) {
         _send(netif, pkt, true);
+        sent++;
+    }
+    if (sent) {
         gnrc_netif_pktq_sched_get(netif);
     }
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -1897,6 +2046,60 @@ static void _tx_done(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
 }
 
 #if IS_USED(MODULE_NETDEV_NEW_API)
+/**
+ * @brief   Memorize a frame handed to the device until it is confirmed
+ *
+ * @param[in]   netif       gnrc_netif instance to operate on
+ * @param[in]   pkt         the frame
+ * @param[in]   push_back   the frame was taken from the packet queue
+ */
+static void _tx_pkt_push(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                         bool push_back)
+{
+    push_back = IS_USED(MODULE_GNRC_NETIF_PKTQ) && push_back;
+#if CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1
+    if (netif->tx_pkt != NULL) {
+        if (push_back) {
+            netif->tx_queue_pktq |= 1U << netif->tx_queue_len;
+        }
+        netif->tx_queue[netif->tx_queue_len++] = pkt;
+        return;
+    }
+#endif
+    netif->tx_pkt = pkt;
+    if (push_back) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
+    }
+}
+
+/**
+ * @brief   Forget the oldest frame handed to the device
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if the frame was taken from the packet queue
+ */
+static bool _tx_pkt_pop(gnrc_netif_t *netif)
+{
+    bool push_back = netif->flags & GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
+
+    netif->tx_pkt = NULL;
+    netif->flags &= ~GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
+#if CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1
+    if (netif->tx_queue_len > 0) {
+        netif->tx_pkt = netif->tx_queue[0];
+        if (netif->tx_queue_pktq & 1U) {
+            netif->flags |= GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
+        }
+        netif->tx_queue_pktq >>= 1;
+        netif->tx_queue_len--;
+        memmove(&netif->tx_queue[0], &netif->tx_queue[1],
+                netif->tx_queue_len * sizeof(netif->tx_queue[0]));
+    }
+#endif
+    return push_back;
+}
+
 /**
  * @brief   Call the confirm_send handler from an event
  *
@@ -1905,21 +2108,30 @@ static void _tx_done(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
 static void _event_handler_tx_done(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_tx_done);
-    int res = netif->dev->driver->confirm_send(netif->dev, NULL);
-    /* after confirm_send() is called, the device is ready to send the next
-     * frame. So clear netif->tx_pkt to signal readiness */
-    gnrc_pktsnip_t *pkt = netif->tx_pkt;
-    netif->tx_pkt = NULL;
-    bool push_back = netif->flags & GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
-    netif->flags &= ~GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
-    _tx_done(netif, pkt, NULL, res, push_back);
+
+    /* confirm all frames completed so far, the device reports them in the
+     * order they were sent */
+    while (netif->tx_pkt != NULL) {
+        int res = netif->dev->driver->confirm_send(netif->dev, NULL);
+
+        if (res == -EAGAIN) {
+            break;
+        }
+        /* after confirm_send() is called, the device is ready to send the next
+         * frame. So remove the frame from netif->tx_pkt to signal readiness */
+        gnrc_pktsnip_t *pkt = netif->tx_pkt;
+        bool push_back = _tx_pkt_pop(netif);
+        _tx_done(netif, pkt, NULL, res, push_back);
+    }
+    /* refill the device with packets that waited for it */
+    _send_queued_pkt(netif);
 }
 #endif
 
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
 #if IS_USED(MODULE_NETDEV_NEW_API)
-    if (netif->tx_pkt != NULL) {
+    if (_tx_busy(netif)) {
         /* Upper layer is handing out frames faster than hardware can transmit.
          * Note that not only doesn't it make sense to bother the driver if it
          * is still busy, but overwriting netif->tx_pkt would leak the memory
@@ -1993,12 +2205,8 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     else {
         /* new API *and* send() was a success --> block netif and memorize
          * frame to free memory later */
-        netif->tx_pkt = pkt;
-
         gnrc_pkt_append(pkt, tx_sync);
-        if (IS_USED(MODULE_GNRC_NETIF_PKTQ) && push_back) {
-            netif->flags |= GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
-        }
+        _tx_pkt_push(netif, pkt, push_back);
     }
 #endif
 }
@@ -2033,6 +2241,16 @@ static void *_gnrc_netif_thread(void *args)
         LOG_ERROR("gnrc_netif: init %u failed: %d\n", thread_getpid(), ctx->result);
         return NULL;
     }
+#if IS_USED(MODULE_NETDEV_NEW_API) && (CONFIG_GNRC_NETIF_TX_QUEUE_LEN > 1)
+    uint8_t tx_queue_len;
+
+    if (gnrc_netif_netdev_new_api(netif) &&
+        (netif->dev->driver->get(netif->dev, NETOPT_TX_QUEUE_LEN, &tx_queue_len,
+                                 sizeof(tx_queue_len)) > 0) &&
+        (tx_queue_len > 1)) {
+        netif->tx_queue_max = MIN(tx_queue_len, CONFIG_GNRC_NETIF_TX_QUEUE_LEN) - 1;
+    }
+#endif
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
 #endif
@@ -2120,6 +2338,12 @@ static void *_gnrc_netif_thread(void *args)
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+    if ((pkt->type == GNRC_NETTYPE_IPV6) &&
+        gnrc_ipv6_fwd_workers_dispatch(pkt)) {
+        return;
+    }
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -14,45 +14,224 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 
+#include "container.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Marks entries in gnrc_netif_pktq_t::queue instead of a flow
+ */
+#define FLOW_NONE       (UINT8_MAX)
+
+/* a flow's deficit is below the length of its head packet plus one quantum */
+static_assert((CONFIG_GNRC_NETIF_PKTQ_QUANTUM >= 64) &&
+              (CONFIG_GNRC_NETIF_PKTQ_QUANTUM <= 32768),
+              "CONFIG_GNRC_NETIF_PKTQ_QUANTUM must be between 64 and 32768");
+
+/**
+ * @brief   Entry of the packet queue pool
+ */
+typedef struct {
+    gnrc_pktqueue_t super;      /**< list node, next free entry if unused */
+    uint8_t cls;                /**< class of the packet */
+    uint8_t flow;               /**< flow of the packet or FLOW_NONE */
+} _entry_t;
+
 static mutex_t _pool_lock = MUTEX_INIT;
-static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+static _entry_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+/* entries that were used before and are free again */
+static gnrc_pktqueue_t *_free;
+/* entries from here on were never used */
+static unsigned _pool_unused;
+static unsigned _used;
 
-static gnrc_pktqueue_t *_get_free_entry(gnrc_pktsnip_t *pkt)
+static _entry_t *_get_free_entry(gnrc_pktsnip_t *pkt)
 {
-    gnrc_pktqueue_t *entry = NULL;
+    _entry_t *entry = NULL;
 
     mutex_lock(&_pool_lock);
-    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
-        if (_pool[i].pkt == NULL) {
-            _pool[i].pkt = pkt;
-            entry = &_pool[i];
-            break;
-        }
+    if (_free != NULL) {
+        entry = container_of(_free, _entry_t, super);
+        _free = _free->next;
+    }
+    else if (_pool_unused < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) {
+        entry = &_pool[_pool_unused++];
+    }
+    if (entry != NULL) {
+        entry->super.pkt = pkt;
+        entry->super.next = NULL;
+        _used++;
     }
     mutex_unlock(&_pool_lock);
 
     return entry;
 }
 
+static void _free_entry(_entry_t *entry)
+{
+    mutex_lock(&_pool_lock);
+    entry->super.pkt = NULL;
+    entry->super.next = _free;
+    _free = &entry->super;
+    _used--;
+    mutex_unlock(&_pool_lock);
+}
+
 unsigned gnrc_netif_pktq_usage(void)
 {
-    unsigned res = 0;
+    return _used;
+}
+
+static uint8_t _class(gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETTYPE_ICMPV6)
+    if (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_ICMPV6) != NULL) {
+        return GNRC_NETIF_PKTQ_CLASS_CTRL;
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    /* forwarded packets are not parsed beyond the IPv6 header */
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if ((ipv6 != NULL) && (ipv6->size >= sizeof(ipv6_hdr_t)) &&
+        (((ipv6_hdr_t *)ipv6->data)->nh == PROTNUM_ICMPV6)) {
+        return GNRC_NETIF_PKTQ_CLASS_CTRL;
+    }
+#endif
+    (void)pkt;
+    return GNRC_NETIF_PKTQ_CLASS_DATA;
+}
+
+static uint8_t _flow(gnrc_pktsnip_t *pkt)
+{
+#if CONFIG_GNRC_NETIF_PKTQ_FLOWS > 1
+    const uint8_t *key = NULL;
+    size_t key_len = 0;
+    unsigned hash = 0;
+
+#  if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if ((ipv6 != NULL) && (ipv6->size >= sizeof(ipv6_hdr_t))) {
+        /* source and destination address are next to each other */
+        key = (uint8_t *)&((ipv6_hdr_t *)ipv6->data)->src;
+        key_len = 2 * sizeof(ipv6_addr_t);
+    }
+    else
+#  endif
+    if ((pkt->type == GNRC_NETTYPE_NETIF) &&
+        (pkt->size >= sizeof(gnrc_netif_hdr_t))) {
+        /* IPv6 header is already compressed, use the next hop instead */
+        gnrc_netif_hdr_t *hdr = pkt->data;
+
+        key = gnrc_netif_hdr_get_dst_addr(hdr);
+        key_len = hdr->dst_l2addr_len;
+    }
+    for (size_t i = 0; i < key_len; i++) {
+        hash = (hash * 31) + key[i];
+    }
+    return hash % CONFIG_GNRC_NETIF_PKTQ_FLOWS;
+#else
+    (void)pkt;
+    return 0;
+#endif
+}
+
+static inline void _stats_put(gnrc_netif_t *netif, uint8_t cls)
+{
+#if IS_USED(MODULE_NETSTATS_PKTQ)
+    netstats_pktq_t *stats = &netif->send_queue.stats[cls];
 
-    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
-        if (_pool[i].pkt != NULL) {
-            res++;
+    stats->enqueued++;
+    if (++stats->len > stats->len_max) {
+        stats->len_max = stats->len;
+    }
+#else
+    (void)netif;
+    (void)cls;
+#endif
+}
+
+static inline void _stats_get(gnrc_netif_t *netif, uint8_t cls)
+{
+#if IS_USED(MODULE_NETSTATS_PKTQ)
+    netif->send_queue.stats[cls].len--;
+#else
+    (void)netif;
+    (void)cls;
+#endif
+}
+
+static inline void _stats_drop(gnrc_netif_t *netif, uint8_t cls)
+{
+#if IS_USED(MODULE_NETSTATS_PKTQ)
+    netif->send_queue.stats[cls].dropped++;
+#else
+    (void)netif;
+    (void)cls;
+#endif
+}
+
+static _entry_t *_remove_head(gnrc_netif_t *netif, gnrc_pktqueue_t **queue)
+{
+    gnrc_pktqueue_t *node = gnrc_pktqueue_remove_head(queue);
+    _entry_t *entry;
+
+    if (node == NULL) {
+        return NULL;
+    }
+    entry = container_of(node, _entry_t, super);
+    if (entry->flow != FLOW_NONE) {
+        gnrc_netif_pktq_t *q = &netif->send_queue;
+
+        q->flow_len[entry->flow]--;
+        q->data_len--;
+        if (q->flow_len[entry->flow] == 0) {
+            /* an idle flow doesn't save up for later */
+            q->deficit[entry->flow] = 0;
         }
     }
-    return res;
+    _stats_get(netif, entry->cls);
+    return entry;
+}
+
+/**
+ * @brief   Makes room for a control packet by dropping the oldest packet of
+ *          the longest flow of @p netif
+ */
+static _entry_t *_evict(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    unsigned longest = 0;
+    _entry_t *entry;
+
+    if (q->data_len == 0) {
+        return NULL;
+    }
+    for (unsigned i = 1; i < CONFIG_GNRC_NETIF_PKTQ_FLOWS; i++) {
+        if (q->flow_len[i] > q->flow_len[longest]) {
+            longest = i;
+        }
+    }
+    entry = _remove_head(netif, &q->flows[longest]);
+    DEBUG("gnrc_netif_pktq: drop %p of flow %u for control packet\n",
+          (void *)entry->super.pkt, longest);
+    _stats_drop(netif, entry->cls);
+    gnrc_pktbuf_release_error(entry->super.pkt, ENOBUFS);
+    entry->super.pkt = pkt;
+    entry->super.next = NULL;
+    return entry;
 }
 
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
@@ -60,15 +239,84 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     assert(netif != NULL);
     assert(pkt != NULL);
 
-    gnrc_pktqueue_t *entry = _get_free_entry(pkt);
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    uint8_t cls = _class(pkt);
+    _entry_t *entry = _get_free_entry(pkt);
 
+    if ((entry == NULL) && (cls == GNRC_NETIF_PKTQ_CLASS_CTRL)) {
+        entry = _evict(netif, pkt);
+    }
     if (entry == NULL) {
+        _stats_drop(netif, cls);
         return -1;
     }
-    gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+    entry->cls = cls;
+    if (cls == GNRC_NETIF_PKTQ_CLASS_CTRL) {
+        entry->flow = FLOW_NONE;
+        gnrc_pktqueue_add(&q->queue, &entry->super);
+    }
+    else {
+        entry->flow = _flow(pkt);
+        q->flow_len[entry->flow]++;
+        q->data_len++;
+        gnrc_pktqueue_add(&q->flows[entry->flow], &entry->super);
+    }
+    _stats_put(netif, cls);
     return 0;
 }
 
+/**
+ * @brief   Picks the next data packet by deficit round robin over the flows
+ */
+static _entry_t *_get_data(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+
+    if (q->data_len == 0) {
+        return NULL;
+    }
+    if (q->flow_len[q->flow] == q->data_len) {
+        /* no other flow to be fair to */
+        return _remove_head(netif, &q->flows[q->flow]);
+    }
+    /* terminates, as every round adds a quantum to each non-empty flow */
+    while (1) {
+        gnrc_pktqueue_t **flow = &q->flows[q->flow];
+
+        if (*flow != NULL) {
+            size_t len = gnrc_pkt_len((*flow)->pkt);
+
+            if (q->deficit[q->flow] >= len) {
+                q->deficit[q->flow] -= len;
+                return _remove_head(netif, flow);
+            }
+        }
+        if (++q->flow >= CONFIG_GNRC_NETIF_PKTQ_FLOWS) {
+            q->flow = 0;
+        }
+        if (q->flows[q->flow] != NULL) {
+            q->deficit[q->flow] += CONFIG_GNRC_NETIF_PKTQ_QUANTUM;
+        }
+    }
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    gnrc_pktsnip_t *pkt = NULL;
+    _entry_t *entry = _remove_head(netif, &netif->send_queue.queue);
+
+    if (entry == NULL) {
+        entry = _get_data(netif);
+    }
+    if (entry != NULL) {
+        pkt = entry->super.pkt;
+        _free_entry(entry);
+    }
+    return pkt;
+}
+
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
 {
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US > 0
@@ -101,12 +349,18 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     assert(netif != NULL);
     assert(pkt != NULL);
 
-    gnrc_pktqueue_t *entry = _get_free_entry(pkt);
+    uint8_t cls = _class(pkt);
+    _entry_t *entry = _get_free_entry(pkt);
 
     if (entry == NULL) {
+        _stats_drop(netif, cls);
         return -1;
     }
-    LL_PREPEND(netif->send_queue.queue, entry);
+    /* the packet was already picked to be sent next */
+    entry->cls = cls;
+    entry->flow = FLOW_NONE;
+    LL_PREPEND(netif->send_queue.queue, &entry->super);
+    _stats_put(netif, cls);
     return 0;
 }
 
@@ -69,6 +69,56 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+#define _FWD_WORKERS_NUMOF      (CONFIG_GNRC_IPV6_FWD_WORKERS_NUMOF)
+
+static char _worker_stacks[_FWD_WORKERS_NUMOF][GNRC_IPV6_STACK_SIZE +
+                                               DEBUG_EXTRA_STACKSIZE];
+static msg_t _worker_msg_qs[_FWD_WORKERS_NUMOF][GNRC_IPV6_MSG_QUEUE_SIZE];
+static kernel_pid_t _worker_pids[_FWD_WORKERS_NUMOF];
+
+/* Event loop of the forwarding workers */
+static void *_worker_event_loop(void *args);
+#else
+#define _FWD_WORKERS_NUMOF      (0U)
+#endif
+
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+/**
+ * @brief   Forwarding cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;                /**< destination of the flow */
+    gnrc_netif_t *netif;            /**< outgoing interface, NULL if unused */
+    kernel_pid_t in_iface;          /**< receiving interface of the flow */
+    uint8_t l2addr_len;             /**< length of the link-layer address */
+    /**
+     * @brief   link-layer address of the next hop
+     */
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+} _fwd_cache_entry_t;
+
+/**
+ * @brief   Forwarding cache of a thread forwarding packets
+ */
+typedef struct {
+    _fwd_cache_entry_t entries[CONFIG_GNRC_IPV6_FWD_CACHE_SIZE];  /**< entries */
+    unsigned gen_seen;              /**< generation at the last flush */
+    unsigned next;                  /**< entry to replace next */
+    /**
+     * @brief   receiving interface of the packet currently forwarded via
+     *          _send()
+     */
+    kernel_pid_t in_iface;
+} _fwd_cache_t;
+
+/* one cache each for the IPv6 thread and each forwarding worker, so only the
+ * generation is shared */
+static _fwd_cache_t _fwd_caches[1 + _FWD_WORKERS_NUMOF];
+/* bumped by gnrc_ipv6_fwd_cache_flush() from any thread */
+static volatile unsigned _fwd_cache_gen;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -88,6 +138,15 @@ kernel_pid_t gnrc_ipv6_init(void)
         gnrc_ipv6_pid = thread_create(_stack, sizeof(_stack), GNRC_IPV6_PRIO,
                                       0,
                                       _event_loop, NULL, "ipv6");
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+        for (unsigned i = 0; i < _FWD_WORKERS_NUMOF; i++) {
+            _worker_pids[i] = thread_create(_worker_stacks[i],
+                                            sizeof(_worker_stacks[i]),
+                                            GNRC_IPV6_PRIO, 0,
+                                            _worker_event_loop,
+                                            _worker_msg_qs[i], "ipv6_fwd");
+        }
+#endif
     }
 
 #ifdef MODULE_FIB
@@ -383,6 +442,67 @@ static void *_event_loop(void *args)
     return NULL;
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+bool gnrc_ipv6_fwd_workers_dispatch(gnrc_pktsnip_t *pkt)
+{
+    const ipv6_hdr_t *hdr = pkt->data;
+    unsigned hash = 0;
+
+    if ((hdr == NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
+        !ipv6_hdr_is(hdr) || ipv6_addr_is_multicast(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->dst) ||
+        ipv6_addr_is_loopback(&hdr->dst) ||
+        /* others want to see the packet, so leave it to netapi */
+        (gnrc_netreg_num(GNRC_NETTYPE_IPV6,
+                         GNRC_NETREG_DEMUX_CTX_ALL) != 1)) {
+        return false;
+    }
+    /* source and destination address are next to each other */
+    const uint8_t *key = (const uint8_t *)&hdr->src;
+
+    for (unsigned i = 0; i < (2 * sizeof(ipv6_addr_t)); i++) {
+        hash = (hash * 31) + key[i];
+    }
+
+    kernel_pid_t pid = _worker_pids[hash % _FWD_WORKERS_NUMOF];
+
+    DEBUG("ipv6: hand packet to forwarding worker %" PRIkernel_pid "\n", pid);
+    if (gnrc_netapi_receive(pid, pkt) < 1) {
+        DEBUG("ipv6: message queue of forwarding worker full, drop packet\n");
+        gnrc_pktbuf_release_error(pkt, ENOBUFS);
+    }
+    return true;
+}
+
+static void *_worker_event_loop(void *args)
+{
+    msg_t msg, reply;
+
+    msg_init_queue(args, GNRC_IPV6_MSG_QUEUE_SIZE);
+    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+    while (1) {
+        msg_receive(&msg);
+
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_RCV:
+                DEBUG("ipv6_fwd: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+                _receive(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_GET:
+            case GNRC_NETAPI_MSG_TYPE_SET:
+                DEBUG("ipv6_fwd: reply to unsupported get/set\n");
+                reply.content.value = -ENOTSUP;
+                msg_reply(&msg, &reply);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return NULL;
+}
+#endif  /* MODULE_GNRC_IPV6_FWD_WORKERS */
+
 static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     const ipv6_hdr_t *hdr = pkt->next->data;
@@ -614,6 +734,86 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+void gnrc_ipv6_fwd_cache_flush(void)
+{
+    unsigned irq_state = irq_disable();
+    _fwd_cache_gen++;
+    irq_restore(irq_state);
+}
+
+static _fwd_cache_t *_fwd_cache_of_thread(void)
+{
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+    kernel_pid_t pid = thread_getpid();
+
+    for (unsigned i = 0; i < _FWD_WORKERS_NUMOF; i++) {
+        if (_worker_pids[i] == pid) {
+            return &_fwd_caches[i + 1];
+        }
+    }
+#endif
+    return &_fwd_caches[0];
+}
+
+static _fwd_cache_entry_t *_fwd_cache_get(_fwd_cache_t *cache,
+                                          const ipv6_addr_t *dst,
+                                          kernel_pid_t in_iface)
+{
+    unsigned gen = _fwd_cache_gen;
+
+    if (gen != cache->gen_seen) {
+        DEBUG("ipv6: flush forwarding cache\n");
+        memset(cache->entries, 0, sizeof(cache->entries));
+        cache->gen_seen = gen;
+        return NULL;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->entries); i++) {
+        _fwd_cache_entry_t *entry = &cache->entries[i];
+
+        if ((entry->netif != NULL) && (entry->in_iface == in_iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void _fwd_cache_set(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                           const gnrc_ipv6_nib_nc_t *nce)
+{
+    _fwd_cache_t *cache = _fwd_cache_of_thread();
+
+    if (cache->in_iface == KERNEL_PID_UNDEF) {
+        /* packet is not forwarded */
+        return;
+    }
+    if (_fwd_cache_gen != cache->gen_seen) {
+        /* NIB changed since the last lookup, the next hop might be outdated */
+        return;
+    }
+    /* neighbors in any other state need the NIB to probe them on use */
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) &&
+        (gnrc_ipv6_nib_nc_get_nud_state(nce) !=
+         GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) &&
+        (gnrc_ipv6_nib_nc_get_nud_state(nce) !=
+         GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED)) {
+        return;
+    }
+    _fwd_cache_entry_t *entry = &cache->entries[cache->next];
+
+    cache->next = (cache->next + 1) % ARRAY_SIZE(cache->entries);
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    entry->netif = netif;
+    entry->in_iface = cache->in_iface;
+    entry->l2addr_len = nce->l2addr_len;
+    memcpy(entry->l2addr, nce->l2addr, nce->l2addr_len);
+    DEBUG("ipv6: cache next hop %s for forwarding to ",
+          ipv6_addr_to_str(addr_str, &nce->ipv6, sizeof(addr_str)));
+    DEBUG("%s\n", ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+}
+#endif  /* MODULE_GNRC_IPV6_FWD_CACHE */
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
@@ -630,6 +830,11 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+    if (!prep_hdr) {
+        _fwd_cache_set(&ipv6_hdr->dst, netif, &nce);
+    }
+#endif
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
@@ -874,12 +1079,58 @@ static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+/* Forwards pkt to the next hop cached for its flow without consulting the NIB.
+ * Returns false if pkt needs to take the regular path */
+static bool _forward_cached(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif_hdr,
+                            ipv6_hdr_t *hdr)
+{
+    kernel_pid_t in_iface = ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid;
+    _fwd_cache_entry_t *entry;
+
+    /* packets reaching hop limit 0 or with a link-local source need an
+     * ICMPv6 error, leave that to the regular path */
+    if ((hdr->hl <= 1) || ipv6_addr_is_link_local(&hdr->src) ||
+        ((entry = _fwd_cache_get(_fwd_cache_of_thread(), &hdr->dst,
+                                 in_iface)) == NULL)) {
+        return false;
+    }
+
+    gnrc_netif_t *netif = entry->netif;
+
+    hdr->hl--;
+    DEBUG("ipv6: forward packet to cached next hop over interface %"
+          PRIkernel_pid "\n", netif->pid);
+    gnrc_pktbuf_remove_snip(pkt, netif_hdr);
+    pkt = gnrc_pktbuf_reverse_snips(pkt);
+    if (pkt == NULL) {
+        DEBUG("ipv6: unable to reverse pkt from receive order to send "
+              "order; dropping it\n");
+        return true;
+    }
+    if ((pkt = _create_netif_hdr(entry->l2addr, entry->l2addr_len, pkt,
+                                 0U)) == NULL) {
+        return true;
+    }
+#ifdef MODULE_NETSTATS_IPV6
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netif->ipv6.stats.tx_unicast_count++;
+    irq_restore(irq_state);
+#endif
+    _send_to_iface(netif, pkt);
+    return true;
+}
+#endif  /* MODULE_GNRC_IPV6_FWD_CACHE */
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_t *netif = NULL;
     gnrc_pktsnip_t *ipv6, *netif_hdr;
     ipv6_hdr_t *hdr;
     uint8_t first_nh;
+    bool not_for_me;
 
     assert(pkt != NULL);
 
@@ -887,7 +1138,26 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
     if (netif_hdr != NULL) {
         netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
+    }
+#if IS_USED(MODULE_GNRC_IPV6_FWD_WORKERS)
+    if (thread_getpid() != gnrc_ipv6_pid) {
+        gnrc_netif_t *dst_netif = netif;
+
+        /* forwarding workers leave packets for this host to the IPv6 thread,
+         * e.g. reassembly of fragmented packets is not thread-safe. It
+         * receives them from scratch, so hand them over before counting.
+         * Workers only get IPv6 packets, see gnrc_ipv6_fwd_workers_dispatch() */
+        if (!_pkt_not_for_me(&dst_netif, pkt->data)) {
+            DEBUG("ipv6: hand packet for this host to IPv6 thread\n");
+            if (gnrc_netapi_receive(gnrc_ipv6_pid, pkt) < 1) {
+                gnrc_pktbuf_release(pkt);
+            }
+            return;
+        }
+    }
+#endif
 #ifdef MODULE_NETSTATS_IPV6
+    if (netif_hdr != NULL) {
         assert(netif != NULL);
         /* This is read from the netif thread. To prevent data corruptions, we
          * have to guarantee mutually exclusive access */
@@ -896,8 +1166,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
         stats->rx_count++;
         stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
         irq_restore(irq_state);
-#endif
     }
+#endif
 
     if ((pkt->data == NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
         !ipv6_hdr_is(pkt->data)) {
@@ -932,6 +1202,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
     pkt = ipv6;     /* reset pkt from temporary variable */
 
+    not_for_me = _pkt_not_for_me(&netif, pkt->data);
+
     ipv6 = gnrc_pktbuf_mark(pkt, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
 
     pkt->type = GNRC_NETTYPE_UNDEF; /* snip is no longer IPv6 */
@@ -984,12 +1256,20 @@ static void _receive(gnrc_pktsnip_t *pkt)
           ipv6_addr_to_str(addr_str, &(hdr->dst), sizeof(addr_str)),
           first_nh, byteorder_ntohs(hdr->len));
 
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+    /* hop-by-hop options need to be processed by every hop */
+    if ((first_nh != PROTNUM_IPV6_EXT_HOPOPT) && (netif_hdr != NULL) &&
+        not_for_me && _forward_cached(pkt, netif_hdr, hdr)) {
+        return;
+    }
+#endif
+
     if ((pkt = gnrc_ipv6_ext_process_hopopt(pkt, &first_nh)) == NULL) {
         DEBUG("ipv6: packet's extension header was erroneous or packet was "
               "consumed due to it\n");
         return;
     }
-    if (_pkt_not_for_me(&netif, hdr)) { /* if packet is not for me */
+    if (not_for_me) { /* if packet is not for me */
         DEBUG("ipv6: packet destination not this host\n");
 
 #ifdef MODULE_GNRC_IPV6_ROUTER    /* only routers redirect */
@@ -1021,6 +1301,10 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
             /* remove L2 headers around IPV6 */
             if (netif_hdr != NULL) {
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+                _fwd_cache_of_thread()->in_iface =
+                    ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid;
+#endif
                 gnrc_pktbuf_remove_snip(pkt, netif_hdr);
             }
             pkt = gnrc_pktbuf_reverse_snips(pkt);
@@ -1031,6 +1315,9 @@ static void _receive(gnrc_pktsnip_t *pkt)
                 DEBUG("ipv6: unable to reverse pkt from receive order to send "
                       "order; dropping it\n");
             }
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+            _fwd_cache_of_thread()->in_iface = KERNEL_PID_UNDEF;
+#endif
             return;
         }
         else {
@@ -18,6 +18,7 @@
 
 #include "evtimer.h"
 #include "net/gnrc/ndp.h"
+#include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netreg.h"
@@ -450,6 +451,8 @@ void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
 {
     nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     nce->info |= state;
+    /* the forwarding cache only holds next hops that are reachable */
+    gnrc_ipv6_fwd_cache_flush();
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     gnrc_netif_acquire(netif);
@@ -41,6 +41,12 @@ static clist_node_t _next_removable = { NULL };
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
+#if CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE
+/* heads and links of the hash chains of _dsts, an entry is referred to by its
+ * index + 1, so 0 terminates a chain */
+static uint16_t _dsts_idx[CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE];
+static uint16_t _dsts_idx_next[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
@@ -63,6 +69,9 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE
+    memset(_dsts_idx, 0, sizeof(_dsts_idx));
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -98,6 +107,8 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+    /* the forwarding cache of gnrc_ipv6 may now resolve to another entry */
+    gnrc_ipv6_fwd_cache_flush();
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -268,6 +279,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     DEBUG("nib: remove from neighbor cache (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
+    gnrc_ipv6_fwd_cache_flush();
     node->mode &= ~(_NC);
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
@@ -334,6 +346,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
 {
     _nib_dr_entry_t *def_router = NULL;
 
+    gnrc_ipv6_fwd_cache_flush();
     DEBUG("nib: Allocating default router list entry "
           "(router_addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, router_addr, sizeof(addr_str)), iface);
@@ -368,6 +381,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
 
 void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
 {
+    gnrc_ipv6_fwd_cache_flush();
     if (nib_dr->next_hop != NULL) {
         _evtimer_del(&nib_dr->rtr_timeout);
         nib_dr->next_hop->mode &= ~(_DRL);
@@ -475,6 +489,87 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static inline bool _in_dsts(const _nib_offl_entry_t *dst)
+{
+    return (dst < (_dsts + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF));
+}
+
+static inline unsigned _idx_dsts(const _nib_offl_entry_t *dst)
+{
+    return (dst - _dsts);
+}
+
+static inline bool _offl_is_pfx(const _nib_offl_entry_t *dst,
+                                const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    return (dst->mode != _EMPTY) && (dst->pfx_len == pfx_len) &&
+           (ipv6_addr_match_prefix(&dst->pfx, pfx) >= pfx_len);
+}
+
+#if CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE
+static uint16_t *_dsts_idx_bucket(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    ipv6_addr_t key;
+    uint32_t hash = pfx_len;
+
+    ipv6_addr_set_unspecified(&key);
+    ipv6_addr_init_prefix(&key, pfx, pfx_len);
+    for (unsigned i = 0; i < ARRAY_SIZE(key.u32); i++) {
+        hash = (hash * 31) + key.u32[i].u32;
+    }
+    return &_dsts_idx[hash % CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE];
+}
+
+static void _dsts_idx_add(const _nib_offl_entry_t *dst)
+{
+    uint16_t *head = _dsts_idx_bucket(&dst->pfx, dst->pfx_len);
+
+    _dsts_idx_next[_idx_dsts(dst)] = *head;
+    *head = _idx_dsts(dst) + 1;
+}
+
+static void _dsts_idx_del(const _nib_offl_entry_t *dst)
+{
+    uint16_t *link = _dsts_idx_bucket(&dst->pfx, dst->pfx_len);
+
+    while (*link != 0) {
+        if (*link == (_idx_dsts(dst) + 1)) {
+            *link = _dsts_idx_next[_idx_dsts(dst)];
+            return;
+        }
+        link = &_dsts_idx_next[*link - 1];
+    }
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
+#define _dsts_idx_add(dst)  (void)(dst)
+#define _dsts_idx_del(dst)  (void)(dst)
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
+
+_nib_offl_entry_t *_nib_offl_iter_pfx(const _nib_offl_entry_t *last,
+                                      const ipv6_addr_t *pfx,
+                                      unsigned pfx_len)
+{
+#if CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE
+    uint16_t next = (last) ? _dsts_idx_next[_idx_dsts(last)]
+                           : *_dsts_idx_bucket(pfx, pfx_len);
+
+    for (; next != 0; next = _dsts_idx_next[next - 1]) {
+        if (_offl_is_pfx(&_dsts[next - 1], pfx, pfx_len)) {
+            return &_dsts[next - 1];
+        }
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
+    for (const _nib_offl_entry_t *dst = (last) ? (last + 1) : _dsts;
+         _in_dsts(dst);
+         dst++) {
+        if (_offl_is_pfx(dst, pfx, pfx_len)) {
+            return (_nib_offl_entry_t *)dst;
+        }
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE */
+    return NULL;
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -489,37 +584,36 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
-        _nib_offl_entry_t *tmp = &_dsts[i];
-        _nib_onl_entry_t *tmp_node = tmp->next_hop;
-
-        if (tmp->mode == _EMPTY) {
-            if (dst == NULL) {
-                dst = tmp;
-            }
-            continue;
-        }
-
-        /* else: offlink entry not empty, potential match */
-        if (tmp->pfx_len == pfx_len && ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len) {
-            /* prefix matches */
-            assert(tmp_node);
-            if (_nib_onl_get_if(tmp_node) == iface && (ipv6_addr_is_unspecified(&tmp_node->ipv6)
-                                                       || _addr_equals(next_hop, tmp_node))) {
-                /* next hop matches or is unspecified */
-                DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
-                    /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-                }
-                /*mark that this NCE is used by an offl_entry*/
-                tmp->next_hop->mode |= _DST;
-                return tmp;
+    gnrc_ipv6_fwd_cache_flush();
+    while ((dst = _nib_offl_iter_pfx(dst, pfx, pfx_len))) {
+        /* prefix matches */
+        _nib_onl_entry_t *tmp_node = dst->next_hop;
+
+        assert(tmp_node);
+        if (_nib_onl_get_if(tmp_node) == iface && (ipv6_addr_is_unspecified(&tmp_node->ipv6)
+                                                   || _addr_equals(next_hop, tmp_node))) {
+            /* next hop matches or is unspecified */
+            DEBUG("  %p is an exact match\n", (void *)dst);
+            if (next_hop != NULL) {
+                /* sets next_hop if it was previously unspecified */
+                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
             }
+            /*mark that this NCE is used by an offl_entry*/
+            dst->next_hop->mode |= _DST;
+            return dst;
+        }
+    }
+    for (dst = _dsts; _in_dsts(dst); dst++) {
+        if (dst->mode == _EMPTY) {
+            break;
         }
     }
-    if (dst != NULL) {
+    if (_in_dsts(dst)) {
         DEBUG("  using %p\n", (void *)dst);
+        if (dst->pfx_len != 0) {
+            /* was allocated before, but never used */
+            _dsts_idx_del(dst);
+        }
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
@@ -528,21 +622,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _dsts_idx_add(dst);
+        return dst;
     }
-    return dst;
-}
-
-static inline bool _in_dsts(const _nib_offl_entry_t *dst)
-{
-    return (dst < (_dsts + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF));
+    return NULL;
 }
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
-static inline unsigned _idx_dsts(const _nib_offl_entry_t *dst)
-{
-    return (dst - _dsts);
-}
-
 static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 {
     return (abr < (_abrs + CONFIG_GNRC_IPV6_NIB_ABR_NUMOF));
@@ -551,6 +637,7 @@ static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 
 void _nib_offl_clear(_nib_offl_entry_t *dst)
 {
+    gnrc_ipv6_fwd_cache_flush();
     if (dst->mode == _EMPTY) {
         if (dst->next_hop != NULL) {
             _nib_offl_entry_t *ptr;
@@ -566,6 +653,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (dst->pfx_len != 0) {
+            _dsts_idx_del(dst);
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -601,6 +691,13 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    if (CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE) {
+        /* a host route is always the longest match */
+        res = _nib_offl_iter_pfx(NULL, dst, IPV6_ADDR_BIT_LEN);
+        if (res != NULL) {
+            return res;
+        }
+    }
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -683,6 +780,8 @@ void _nib_pl_remove(_nib_offl_entry_t *nib_offl)
 {
     _evtimer_del(&nib_offl->pfx_timeout);
     _nib_offl_remove(nib_offl, _PL);
+    /* source address selection caps prefix matches at the prefix length */
+    gnrc_netif_ipv6_src_cache_flush(NULL);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     unsigned idx = _idx_dsts(nib_offl);
     if (idx < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) {
@@ -846,6 +945,7 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
     if (dst == NULL) {
         return NULL;
     }
+    gnrc_netif_ipv6_src_cache_flush(gnrc_netif_get_by_pid(iface));
     assert(valid_ltime >= pref_ltime);
     if ((valid_ltime != UINT32_MAX) || (pref_ltime != UINT32_MAX)) {
         uint32_t now = evtimer_now_msec();
@@ -603,6 +603,22 @@ void _nib_offl_clear(_nib_offl_entry_t *dst);
  */
 _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
 
+/**
+ * @brief   Iterates over off-link entries for exactly the given prefix
+ *
+ * Only walks the entries hashed to @p pfx, if
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_SIZE is not 0.
+ *
+ * @param[in] last      Last entry (NULL to start).
+ * @param[in] pfx       The IPv6 prefix or address of the destination.
+ * @param[in] pfx_len   The length in bits of @p pfx.
+ *
+ * @return  entry for @p pfx/@p pfx_len after @p last.
+ */
+_nib_offl_entry_t *_nib_offl_iter_pfx(const _nib_offl_entry_t *last,
+                                      const ipv6_addr_t *pfx,
+                                      unsigned pfx_len);
+
 /**
  * @brief   Checks if @p entry was allocated using _nib_offl_alloc()
  *
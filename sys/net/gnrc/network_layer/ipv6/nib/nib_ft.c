@@ -107,14 +107,10 @@ void gnrc_ipv6_nib_ft_del(const ipv6_addr_t *dst, unsigned dst_len)
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     else {
-        _nib_offl_entry_t *entry = NULL;
+        _nib_offl_entry_t *entry = _nib_offl_iter_pfx(NULL, dst, dst_len);
 
-        while ((entry = _nib_offl_iter(entry))) {
-            if ((entry->pfx_len == dst_len) &&
-                (ipv6_addr_match_prefix(&entry->pfx, dst) >= dst_len)) {
-                _nib_ft_remove(entry);
-                break;
-            }
+        if (entry != NULL) {
+            _nib_ft_remove(entry);
         }
     }
 #endif
@@ -394,6 +394,10 @@ static void *_event_loop(void *args)
                 instance = msg.content.ptr;
                 _dodag_float_timeout(&instance->dodag);
                 break;
+            case GNRC_RPL_MSG_TYPE_DAO_ACK_TX:
+                DEBUG("RPL: GNRC_RPL_MSG_TYPE_DAO_ACK_TX received\n");
+                gnrc_rpl_send_DAO_ACK_batch();
+                break;
             case GNRC_RPL_MSG_TYPE_TRICKLE_MSG:
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_TRICKLE_MSG received\n");
                 trickle = msg.content.ptr;
@@ -55,6 +55,17 @@
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF
+/* DAO-ACKs held back until the next GNRC_RPL_MSG_TYPE_DAO_ACK_TX */
+static struct {
+    ipv6_addr_t dst;
+    uint8_t instance_id;
+    uint8_t seq;
+} _dao_acks[CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF];
+static unsigned _dao_acks_numof;
+static evtimer_msg_event_t _dao_ack_event;
+#endif
+
 /**
  * @brief   Checks validity of DIO control messages
  *
@@ -1237,6 +1248,50 @@ void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination,
     gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
 }
 
+void gnrc_rpl_send_DAO_ACK_batch(void)
+{
+#if CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF
+    evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&_dao_ack_event);
+    for (unsigned i = 0; i < _dao_acks_numof; i++) {
+        /* the instance may have been removed in the meantime */
+        gnrc_rpl_instance_t *inst = gnrc_rpl_instance_get(_dao_acks[i].instance_id);
+
+        if (inst != NULL) {
+            gnrc_rpl_send_DAO_ACK(inst, &_dao_acks[i].dst, _dao_acks[i].seq);
+        }
+    }
+    _dao_acks_numof = 0;
+#endif
+}
+
+static void _dao_ack_batch_add(gnrc_rpl_instance_t *inst, ipv6_addr_t *dst, uint8_t seq)
+{
+#if CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF
+    for (unsigned i = 0; i < _dao_acks_numof; i++) {
+        if ((_dao_acks[i].instance_id == inst->id) &&
+            ipv6_addr_equal(&_dao_acks[i].dst, dst)) {
+            /* repeated DAO of the same child, acknowledge only the latest */
+            _dao_acks[i].seq = seq;
+            return;
+        }
+    }
+    if (_dao_acks_numof == CONFIG_GNRC_RPL_DAO_ACK_BATCH_NUMOF) {
+        gnrc_rpl_send_DAO_ACK_batch();
+    }
+    if (_dao_acks_numof == 0) {
+        ((evtimer_event_t *)&_dao_ack_event)->offset = CONFIG_GNRC_RPL_DAO_ACK_BATCH_DELAY;
+        _dao_ack_event.msg.type = GNRC_RPL_MSG_TYPE_DAO_ACK_TX;
+        evtimer_add_msg(&gnrc_rpl_evtimer, &_dao_ack_event, gnrc_rpl_pid);
+    }
+    _dao_acks[_dao_acks_numof].dst = *dst;
+    _dao_acks[_dao_acks_numof].instance_id = inst->id;
+    _dao_acks[_dao_acks_numof].seq = seq;
+    _dao_acks_numof++;
+#else
+    gnrc_rpl_send_DAO_ACK(inst, dst, seq);
+#endif
+}
+
 void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src, ipv6_addr_t *dst,
                        uint16_t len)
 {
@@ -1296,10 +1351,13 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
 
     /* send a DAO-ACK if K flag is set */
     if (dao->k_d_flags & GNRC_RPL_DAO_K_BIT) {
-        gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
+        _dao_ack_batch_add(inst, src, dao->dao_sequence);
     }
 
-    gnrc_rpl_delay_dao(dodag);
+    /* the root does not send DAOs, so there is nothing to delay */
+    if (dodag->node_status != GNRC_RPL_ROOT_NODE) {
+        gnrc_rpl_delay_dao(dodag);
+    }
 }
 
 void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6_addr_t *src,
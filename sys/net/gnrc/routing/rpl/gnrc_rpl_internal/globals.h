@@ -49,6 +49,10 @@ extern evtimer_msg_t gnrc_rpl_evtimer;
  * @brief   Message type for floating DODAG timeouts.
  */
 #define GNRC_RPL_MSG_TYPE_DODAG_FLOAT_TIMEOUT  (0x0907)
+/**
+ * @brief   Message type for batched DAO-ACK transmissions.
+ */
+#define GNRC_RPL_MSG_TYPE_DAO_ACK_TX          (0x0908)
 /** @} */
 
 /**
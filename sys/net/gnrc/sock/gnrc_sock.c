@@ -23,6 +23,8 @@
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/ipv6/hdr.h"
@@ -197,9 +199,60 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
+void gnrc_sock_select_src(sock_ip_ep_t *local, const sock_ip_ep_t *remote)
+{
+#ifdef SOCK_HAS_IPV6
+    const ipv6_addr_t *dst = (const ipv6_addr_t *)&remote->addr.ipv6;
+    gnrc_netif_t *netif = NULL;
+    ipv6_addr_t *src;
+
+    if ((local->family != AF_INET6) || (remote->family != AF_INET6) ||
+        !ipv6_addr_is_unspecified((ipv6_addr_t *)&local->addr.ipv6) ||
+        ipv6_addr_is_multicast(dst) || ipv6_addr_is_loopback(dst)) {
+        /* leave it to the network layer */
+        return;
+    }
+    if (local->netif != SOCK_ADDR_ANY_NETIF) {
+        netif = gnrc_netif_get_by_pid((kernel_pid_t)local->netif);
+    }
+    else if (remote->netif != SOCK_ADDR_ANY_NETIF) {
+        netif = gnrc_netif_get_by_pid((kernel_pid_t)remote->netif);
+    }
+#if IS_USED(MODULE_GNRC_IPV6_NIB)
+    else {
+        gnrc_ipv6_nib_ft_t fte;
+
+        /* do not hand a packet to reactive routing here, the network layer
+         * will take care of that when the datagram arrives there */
+        if (gnrc_ipv6_nib_ft_get(dst, NULL, &fte) == 0) {
+            netif = gnrc_netif_get_by_pid((kernel_pid_t)fte.iface);
+        }
+    }
+#endif
+    if ((netif == NULL) ||
+        ((src = gnrc_netif_ipv6_addr_best_src(netif, dst, false)) == NULL)) {
+        return;
+    }
+    memcpy(&local->addr.ipv6, src, sizeof(ipv6_addr_t));
+    /* pin the interface the source address was selected for */
+    local->netif = netif->pid;
+#else
+    (void)local;
+    (void)remote;
+#endif
+}
+
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh)
 {
+    return gnrc_sock_send_ext(payload, local, remote, nh, true);
+}
+
+ssize_t gnrc_sock_send_ext(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                           const sock_ip_ep_t *remote, uint8_t nh, bool wait)
+{
+    /* only used with gnrc_tx_sync or gnrc_neterr */
+    (void)wait;
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
     gnrc_nettype_t type;
@@ -217,7 +270,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+    if (wait && gnrc_tx_sync_append(payload, &tx_sync)) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
@@ -273,7 +326,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     /* cppcheck-suppress uninitvar
      * (reason: pkt is initialized in AF_INET6 case above, otherwise function
      * will return early) */
-    for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
+    for (gnrc_pktsnip_t *ptr = pkt; wait && (ptr != NULL); ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
         status_subs++;
@@ -286,7 +339,9 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync(&tx_sync);
+    if (wait) {
+        gnrc_tx_sync(&tx_sync);
+    }
 #endif
 
 #ifdef MODULE_GNRC_NETERR
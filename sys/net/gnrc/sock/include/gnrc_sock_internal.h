@@ -164,6 +164,33 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Send a packet internally
+ *
+ * Same as @ref gnrc_sock_send(), but if @p wait is false, the function
+ * returns as soon as the packet was handed to the network layer, i.e. it
+ * neither waits for transmission (`gnrc_tx_sync`) nor collects error reports
+ * (`gnrc_neterr`). Used to queue several datagrams back-to-back and only
+ * wait for the last one.
+ * @internal
+ */
+ssize_t gnrc_sock_send_ext(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                           const sock_ip_ep_t *remote, uint8_t nh, bool wait);
+
+/**
+ * @brief   Selects the source address and outgoing interface for @p remote
+ *          in advance
+ *
+ * If the address of @p local is unspecified, the route to @p remote is
+ * looked up and the best source address (RFC 6724) on the resulting
+ * interface is written to @p local together with that interface. This
+ * allows to send multiple packets to the same remote without having the
+ * network layer redo the selection for each packet. @p local is left as is
+ * if no selection can be made.
+ * @internal
+ */
+void gnrc_sock_select_src(sock_ip_ep_t *local, const sock_ip_ep_t *remote);
 /** @internal
  * @}
  */
@@ -29,7 +29,7 @@
 #include "net/af.h"
 #include "net/gnrc.h"
 #if IS_USED(MODULE_GNRC_TCP)
-#include "net/gnrc/tcp.h"
+#include "net/gnrc/tcp/tcb.h"
 #endif
 #include "net/gnrc/netreg.h"
 #ifdef SOCK_HAS_ASYNC
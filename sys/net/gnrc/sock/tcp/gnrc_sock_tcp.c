@@ -21,6 +21,10 @@
 #include "net/sock/tcp.h"
 #include "sock_types.h"
 
+#ifdef SOCK_HAS_ASYNC_CTX
+#include "net/sock/async/event.h"
+#endif
+
 int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
                      uint16_t local_port, uint16_t flags)
 {
@@ -67,6 +71,13 @@ void sock_tcp_disconnect(sock_tcp_t *sock)
 {
     /* Asserts defined by API. */
     assert(sock != NULL);
+#ifdef SOCK_HAS_ASYNC
+    /* Report nothing from the teardown */
+    sock->async_cb = NULL;
+#endif
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_event_close(sock_tcp_get_async_ctx(sock));
+#endif
     gnrc_tcp_close(sock);
 }
 
@@ -74,6 +85,12 @@ void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
 {
     /* Asserts defined by API. */
     assert(queue != NULL);
+#ifdef SOCK_HAS_ASYNC
+    queue->async_cb = NULL;
+#endif
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_event_close(sock_tcp_queue_get_async_ctx(queue));
+#endif
     gnrc_tcp_stop_listen(queue);
 }
 
@@ -144,3 +161,30 @@ ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
      * until at least some data was transmitted. */
     return gnrc_tcp_send(sock, data, len, 0);
 }
+
+#ifdef SOCK_HAS_ASYNC
+void sock_tcp_set_cb(sock_tcp_t *sock, sock_tcp_cb_t cb, void *arg)
+{
+    sock->async_cb_arg = arg;
+    sock->async_cb = cb;
+}
+
+void sock_tcp_queue_set_cb(sock_tcp_queue_t *queue, sock_tcp_queue_cb_t cb,
+                           void *arg)
+{
+    queue->async_cb_arg = arg;
+    queue->async_cb = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_tcp_get_async_ctx(sock_tcp_t *sock)
+{
+    return &sock->async_ctx;
+}
+
+sock_async_ctx_t *sock_tcp_queue_get_async_ctx(sock_tcp_queue_t *queue)
+{
+    return &queue->async_ctx;
+}
+#endif  /* SOCK_HAS_ASYNC_CTX */
+#endif  /* SOCK_HAS_ASYNC */
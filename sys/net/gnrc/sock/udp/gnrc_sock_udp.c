@@ -330,18 +330,25 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/**
+ * @brief   Checks the end points for sending and binds @p sock implicitly if
+ *          required
+ *
+ * @param[in] sock      sock to send from, may be NULL
+ * @param[in] remote    remote to send to, may be NULL if @p sock is connected
+ * @param[in] aux       auxiliary TX data, may be NULL
+ * @param[out] local    local end point to send from
+ * @param[out] rem      remote end point to send to
+ * @param[out] src_port source port to use
+ *
+ * @return  0 on success
+ * @return  negative errno on error, see @ref sock_udp_sendv_aux()
+ */
+static int _prepare_send(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         sock_udp_aux_tx_t *aux, sock_ip_ep_t *local,
+                         sock_udp_ep_t *rem, uint16_t *src_port)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
-
     assert((sock != NULL) || (remote != NULL));
 
     if (remote != NULL) {
@@ -369,8 +376,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -378,14 +385,14 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -394,37 +401,44 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        *src_port = aux->local.port;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(rem, &sock->remote, sizeof(*rem));
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
+    return 0;
+}
+
+static ssize_t _send(sock_udp_t *sock, const iolist_t *snips,
+                     sock_ip_ep_t *local, const sock_udp_ep_t *rem,
+                     uint16_t src_port, bool wait)
+{
+    gnrc_pktsnip_t *pkt, *payload;
+    ssize_t res;
 
     /* allocate snip for payload */
     payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
@@ -435,12 +449,13 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    pkt = gnrc_udp_hdr_build(payload, src_port, rem->port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send_ext(pkt, local, (const sock_ip_ep_t *)rem,
+                             PROTNUM_UDP, wait);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -449,10 +464,70 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
     return res;
 }
 
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+
+    if ((res = _prepare_send(sock, remote, aux, &local, &rem, &src_port)) < 0) {
+        return res;
+    }
+    return _send(sock, snips, &local, &rem, src_port, true);
+}
+
+int sock_udp_sendmmsg(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num)
+{
+    /* end points the last source address selection was done for ... */
+    sock_ip_ep_t key_local;
+    sock_udp_ep_t key_rem;
+    /* ... and its result */
+    sock_ip_ep_t sel_local;
+    uint16_t src_port = 0;
+    unsigned i;
+
+    assert((msgs != NULL) || (num == 0));
+    for (i = 0; i < num; i++) {
+        sock_ip_ep_t local;
+        sock_udp_ep_t rem;
+        int res = _prepare_send(sock, msgs[i].remote, msgs[i].aux, &local,
+                                &rem, &src_port);
+
+        if (res == 0) {
+            /* source address selection and route lookup are only done when
+             * the end points change within the batch */
+            if ((i == 0) ||
+                (memcmp(&rem, &key_rem, sizeof(rem)) != 0) ||
+                (memcmp(&local, &key_local, sizeof(local)) != 0)) {
+                memcpy(&key_rem, &rem, sizeof(rem));
+                memcpy(&key_local, &local, sizeof(local));
+                gnrc_sock_select_src(&local, (sock_ip_ep_t *)&rem);
+                memcpy(&sel_local, &local, sizeof(local));
+            }
+            /* only wait for transmission (or errors) of the last datagram */
+            res = _send(sock, msgs[i].snips, &sel_local, &rem, src_port,
+                        (i + 1) == num);
+        }
+        msgs[i].res = res;
+        if (res < 0) {
+            break;
+        }
+    }
+    if ((i == 0) && (num > 0)) {
+        return msgs[0].res;
+    }
+    return i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
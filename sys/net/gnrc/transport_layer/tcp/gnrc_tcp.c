@@ -76,6 +76,16 @@ static void _unsched_mbox(evtimer_mbox_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+static bool _retransmit_queue_full(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->pkt_retransmit[ARRAY_SIZE(tcb->pkt_retransmit) - 1] != NULL;
+}
+
+static bool _aborted(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->status & STATUS_ABORTED;
+}
+
 static void _close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -84,6 +94,7 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
     _gnrc_tcp_fsm_state_t state = 0;
+    bool closing;
 
     /* Return if connection is closed */
     state = _gnrc_tcp_fsm_get_state(tcb);
@@ -98,12 +109,22 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     /* Setup connection timeout */
     _sched_connection_timeout(&tcb->event_misc, &mbox);
 
-    /* Start connection teardown sequence */
-    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    /* Start connection teardown sequence, if the FIN fits into the retransmit queue */
+    closing = !_retransmit_queue_full(tcb);
+    if (closing) {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    }
 
     /* Loop until the connection has been closed */
     state = _gnrc_tcp_fsm_get_state(tcb);
     while ((state != FSM_STATE_CLOSED) && (state != FSM_STATE_LISTEN)) {
+        /* Queue FIN as soon as sent data was acknowledged */
+        if (!closing && !_retransmit_queue_full(tcb)) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+            closing = true;
+            state = _gnrc_tcp_fsm_get_state(tcb);
+            continue;
+        }
         mbox_get(&mbox, &msg);
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
@@ -127,6 +148,20 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+static void _close_background(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+
+    /* The eventloop re-opens the TCB if the peer doesn't finish the teardown.
+     * Schedule before closing, reaching LISTEN cancels the timeout. */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+    _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
+                              CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS,
+                              MSG_TYPE_CONNECTION_TIMEOUT, tcb);
+    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    TCP_DEBUG_LEAVE;
+}
+
 static void _abort(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -528,6 +563,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 #endif
             tcb->local_port = local->port;
             tcb->status |= STATUS_LISTENING;
+            tcb->queue = queue;
 
             /* Open connection */
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
@@ -537,6 +573,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
         if (ret) {
             for (size_t j = 0; j <= i; ++j) {
                 tcb->status &= ~(STATUS_LISTENING);
+                tcb->queue = NULL;
                 _abort(tcb);
             }
             break;
@@ -702,6 +739,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     state = _gnrc_tcp_fsm_get_state(tcb);
     if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_CLOSE_WAIT) {
         mutex_unlock(&(tcb->function_lock));
+        if (_aborted(tcb)) {
+            TCP_DEBUG_ERROR("-ECONNABORTED: Connection timed out.");
+            TCP_DEBUG_LEAVE;
+            return -ECONNABORTED;
+        }
         TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
         TCP_DEBUG_LEAVE;
         return -ENOTCONN;
@@ -725,12 +767,18 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was queued for transmission. The retransmit
+     * mechanism takes care of the delivery from here on. */
+    while (ret == 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
-        /* Check if the connections state is closed. If so, a reset was received */
-        if (state == FSM_STATE_CLOSED) {
+        /* Check if the connection is gone. If so, it was reset or timed out */
+        if (state == FSM_STATE_CLOSED || state == FSM_STATE_LISTEN) {
+            if (_aborted(tcb)) {
+                TCP_DEBUG_ERROR("-ECONNABORTED: Connection timed out.");
+                ret = -ECONNABORTED;
+                break;
+            }
             TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
             ret = -ECONNRESET;
             break;
@@ -749,9 +797,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
+        /* Try to send data in case we are not probing */
+        if (!probing_mode) {
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            if (ret != 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -765,8 +816,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                 break;
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
+                /* Nothing of this call was queued, so keep earlier segments */
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                 ret = -ETIMEDOUT;
                 break;
@@ -837,6 +888,11 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_FIN_WAIT_1 &&
         state != FSM_STATE_FIN_WAIT_2 && state != FSM_STATE_CLOSE_WAIT) {
         mutex_unlock(&(tcb->function_lock));
+        if (_aborted(tcb)) {
+            TCP_DEBUG_ERROR("-ECONNABORTED: Connection timed out.");
+            TCP_DEBUG_LEAVE;
+            return -ECONNABORTED;
+        }
         TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
         TCP_DEBUG_LEAVE;
         return -ENOTCONN;
@@ -883,9 +939,14 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* Processing loop */
     while (ret == 0) {
-        /* Check if the connections state is closed. If so, a reset was received */
+        /* Check if the connection is gone. If so, it was reset or timed out */
         state = _gnrc_tcp_fsm_get_state(tcb);
-        if (state == FSM_STATE_CLOSED) {
+        if (state == FSM_STATE_CLOSED || state == FSM_STATE_LISTEN) {
+            if (_aborted(tcb)) {
+                TCP_DEBUG_ERROR("-ECONNABORTED: Connection timed out.");
+                ret = -ECONNABORTED;
+                break;
+            }
             TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
             ret = -ECONNRESET;
             break;
@@ -942,7 +1003,16 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     assert(tcb != NULL);
 
     mutex_lock(&(tcb->function_lock));
-    _close(tcb);
+    /* A TCB of a listening queue is re-opened after the teardown anyway,
+     * so only wait for it if the FIN has to wait for sent data */
+    _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
+    if ((tcb->status & STATUS_LISTENING) && !_retransmit_queue_full(tcb) &&
+        (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT)) {
+        _close_background(tcb);
+    }
+    else {
+        _close(tcb);
+    }
     mutex_unlock(&(tcb->function_lock));
 
     TCP_DEBUG_LEAVE;
@@ -973,6 +1043,7 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
 
         /* Clear LISTENING status causing re-opening on close */
         tcb->status &= ~(STATUS_LISTENING);
+        tcb->queue = NULL;
         _close(tcb);
 
         mutex_unlock(&(tcb->function_lock));
@@ -982,6 +1053,9 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
     mutex_unlock(&(queue->lock));
+
+    /* Drop connection requests held for the closed TCBs */
+    _gnrc_tcp_eventloop_stop_listen();
     TCP_DEBUG_LEAVE;
 }
 
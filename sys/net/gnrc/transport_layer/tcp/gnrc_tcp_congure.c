@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "congure/abe.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_congure.h"
+
+#define GNRC_TCP_CONGURE_RENO_CONSTS { \
+        .fr = _fr, \
+        .same_wnd_adv = _same_wnd_adv, \
+        .ss_cwnd_inc = _ss_cwnd_inc, \
+        .ca_cwnd_inc = _ca_cwnd_inc, \
+        .init_mss = CONFIG_GNRC_TCP_MSS, \
+        /* RFC 3390 bounds for the initial window */ \
+        .cwnd_lower = 1095U, \
+        .cwnd_upper = 2190U, \
+        .init_ssthresh = UINT16_MAX, \
+        .frthresh = CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD, \
+    }
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _ss_cwnd_inc(congure_reno_snd_t *c);
+static void _ca_cwnd_inc(congure_reno_snd_t *c);
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+static const congure_abe_snd_consts_t _consts = {
+    .reno = GNRC_TCP_CONGURE_RENO_CONSTS,
+    .abe_multiplier_numerator = CONFIG_CONGURE_ABE_MULTIPLIER_NUMERATOR_DEFAULT,
+    .abe_multiplier_denominator = CONFIG_CONGURE_ABE_MULTIPLIER_DENOMINATOR_DEFAULT,
+};
+#else
+static const congure_reno_snd_consts_t _consts = GNRC_TCP_CONGURE_RENO_CONSTS;
+#endif
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+    congure_abe_snd_setup(&tcb->congure, &_consts);
+#else
+    congure_reno_snd_setup(&tcb->congure, &_consts);
+#endif
+    tcb->congure.super.driver->init(&tcb->congure.super, tcb);
+    congure_reno_set_mss(&tcb->congure, tcb->mss);
+    /* ACKs are identified by their acknowledgment number */
+    tcb->congure.last_ack = tcb->snd_una;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* TCP resends on duplicate ACKs itself, so do nothing */
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    return tcb->snd_wnd == ack->wnd;
+}
+
+/* the window is counted in bytes, so it must not wrap around */
+static void _cwnd_inc(congure_reno_snd_t *c, unsigned inc)
+{
+    c->super.cwnd = (inc < (unsigned)(UINT16_MAX - c->super.cwnd))
+                  ? (c->super.cwnd + inc) : UINT16_MAX;
+}
+
+static void _ss_cwnd_inc(congure_reno_snd_t *c)
+{
+    _cwnd_inc(c, (c->in_flight_size < c->mss) ? c->in_flight_size : c->mss);
+}
+
+static void _ca_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* about one MSS per round trip (see RFC 5681, section 3.1) */
+    unsigned inc = ((unsigned)c->mss * c->mss) / c->super.cwnd;
+
+    _cwnd_inc(c, inc ? inc : 1);
+}
+#endif
@@ -20,6 +20,8 @@
 #include <assert.h>
 #include <utlist.h>
 #include <errno.h>
+#include <string.h>
+#include "mutex.h"
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
@@ -37,8 +39,39 @@
 
 #define TCP_EVENTLOOP_MSG_QUEUE_SIZE (1 << CONFIG_GNRC_TCP_EVENTLOOP_MSG_QUEUE_SIZE_EXP)
 
+/**
+ * @brief Number of SYNs held while all TCBs of a listening queue are busy
+ */
+#ifdef MODULE_GNRC_IPV6
+#define TCP_SYN_QUEUE_SIZE CONFIG_GNRC_TCP_SYN_QUEUE_SIZE
+#else
+#define TCP_SYN_QUEUE_SIZE (0)
+#endif
+
 static msg_t _eventloop_msg_queue[TCP_EVENTLOOP_MSG_QUEUE_SIZE];
 
+#if TCP_SYN_QUEUE_SIZE
+/**
+ * @brief SYNs to listened ports without a TCB in LISTEN state, oldest first
+ */
+static gnrc_pktsnip_t *_syn_queue[TCP_SYN_QUEUE_SIZE];
+
+/**
+ * @brief Arrival times of the held SYNs in milliseconds
+ */
+static uint32_t _syn_queue_since[TCP_SYN_QUEUE_SIZE];
+
+/**
+ * @brief Lock for the held SYNs, the TCB list is locked after it
+ */
+static mutex_t _syn_queue_lock = MUTEX_INIT;
+
+/**
+ * @brief Timer dropping the oldest held SYN
+ */
+static evtimer_msg_event_t _syn_queue_timeout;
+#endif
+
 /**
  * @brief Allocate memory for GNRC TCP thread stack.
  */
@@ -101,6 +134,271 @@ static int _send(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+/**
+ * @brief Answers a segment no TCB is interested in with a reset.
+ *
+ * @param[in] pkt   Segment to answer.
+ */
+static void _send_reset(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *reset = NULL;
+
+    _gnrc_tcp_pkt_build_reset_from_pkt(&reset, pkt);
+    if (gnrc_netapi_send(_tcp_eventloop_pid, reset) < 1) {
+        gnrc_pktbuf_release(reset);
+        TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+    }
+}
+
+/**
+ * @brief Searches the TCB an incoming segment is meant for.
+ *
+ * @param[in] ip    Network layer header of the segment.
+ * @param[in] syn   True if only SYN, but not ACK is set in the segment.
+ * @param[in] src   Source port of the segment.
+ * @param[in] dst   Destination port of the segment.
+ *
+ * @returns   The fitting TCB or NULL if no TCB is interested in the segment.
+ */
+static gnrc_tcp_tcb_t *_find_tcb(gnrc_pktsnip_t *ip, uint8_t syn, uint16_t src, uint16_t dst)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_tcb_t *tcb = NULL;
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    mutex_lock(&list->lock);
+    tcb = list->head;
+    while (tcb) {
+#ifdef MODULE_GNRC_IPV6
+        /* Check if current TCB is fitting for the incoming packet */
+        if (ip->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
+            /* If SYN is set, a connection is listening on that port ... */
+            ipv6_addr_t *tmp_addr = NULL;
+            _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
+            if (syn && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
+                /* ... and local addr is unspec or pre configured */
+                tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
+                if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
+                    ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
+                    break;
+                }
+            }
+
+            /* If SYN is not set and the ports match ... */
+            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
+                /* .. and the IPv6 addresses match */
+                tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
+                if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
+                    break;
+                }
+            }
+        }
+#else
+        /* Suppress compiler warnings if TCP is built without network layer */
+        TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+        (void) ip;
+        (void) syn;
+        (void) src;
+        (void) dst;
+#endif
+        tcb = tcb->next;
+    }
+    mutex_unlock(&list->lock);
+    TCP_DEBUG_LEAVE;
+    return tcb;
+}
+
+#if TCP_SYN_QUEUE_SIZE
+/**
+ * @brief Checks if a SYN without a TCB in LISTEN state should be held.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] ip    IPv6 header of the SYN.
+ * @param[in] src   Source port of the SYN.
+ * @param[in] dst   Destination port of the SYN.
+ *
+ * @returns   Zero if a listening queue serves @p dst.
+ *            -EALREADY if a TCB answered an earlier copy of the SYN.
+ *            -ENOTCONN if nobody listens on @p dst.
+ */
+static int _syn_check(const ipv6_hdr_t *ip, uint16_t src, uint16_t dst)
+{
+    int ret = -ENOTCONN;
+
+    for (gnrc_tcp_tcb_t *tcb = _gnrc_tcp_common_get_tcb_list()->head; tcb; tcb = tcb->next) {
+        if (tcb->local_port != dst) {
+            continue;
+        }
+        if (tcb->peer_port == src && ipv6_addr_equal((ipv6_addr_t *)tcb->peer_addr, &ip->src)) {
+            return -EALREADY;
+        }
+        if ((tcb->status & STATUS_LISTENING) &&
+            ((tcb->status & STATUS_ALLOW_ANY_ADDR) ||
+             ipv6_addr_equal((ipv6_addr_t *)tcb->local_addr, &ip->dst))) {
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Removes a SYN from the queue of held SYNs.
+ *
+ * @param[in] pos   Position of the SYN in the queue.
+ */
+static void _syn_queue_remove(unsigned pos)
+{
+    memmove(&_syn_queue[pos], &_syn_queue[pos + 1],
+            (TCP_SYN_QUEUE_SIZE - pos - 1) * sizeof(_syn_queue[0]));
+    memmove(&_syn_queue_since[pos], &_syn_queue_since[pos + 1],
+            (TCP_SYN_QUEUE_SIZE - pos - 1) * sizeof(_syn_queue_since[0]));
+    _syn_queue[TCP_SYN_QUEUE_SIZE - 1] = NULL;
+}
+
+/**
+ * @brief Drops held SYNs older than the connection timeout, their peers
+ *        gave up on them.
+ *
+ * @note Must be called from a context where the SYN queue is locked.
+ */
+static void _syn_queue_expire(void)
+{
+    uint32_t now = evtimer_now_msec();
+
+    while (_syn_queue[0] != NULL &&
+           now - _syn_queue_since[0] >= CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS) {
+        TCP_DEBUG_INFO("Dropping held SYN.");
+        gnrc_pktbuf_release(_syn_queue[0]);
+        _syn_queue_remove(0);
+    }
+}
+
+/**
+ * @brief Restarts the timer for the oldest held SYN.
+ *
+ * @note Must be called from a context where the SYN queue is locked.
+ */
+static void _syn_queue_sched(void)
+{
+    _gnrc_tcp_eventloop_unsched(&_syn_queue_timeout);
+    if (_syn_queue[0] != NULL) {
+        uint32_t waited = evtimer_now_msec() - _syn_queue_since[0];
+
+        _gnrc_tcp_eventloop_sched(&_syn_queue_timeout,
+                                  (waited < CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS)
+                                  ? CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS - waited
+                                  : 0, MSG_TYPE_SYN_TIMEOUT, NULL);
+    }
+}
+
+/**
+ * @brief Holds a SYN until a TCB of the listening queue is in LISTEN state.
+ *
+ * @param[in] pkt   SYN without a fitting TCB.
+ * @param[in] ip    IPv6 header of @p pkt.
+ * @param[in] src   Source port of @p pkt.
+ * @param[in] dst   Destination port of @p pkt.
+ *
+ * @returns   True if @p pkt was taken over or released.
+ *            False if nobody listens on @p dst, a reset should be sent.
+ */
+static bool _syn_queue_add(gnrc_pktsnip_t *pkt, const ipv6_hdr_t *ip,
+                           uint16_t src, uint16_t dst)
+{
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    unsigned pos = TCP_SYN_QUEUE_SIZE;
+    unsigned num;
+
+    mutex_lock(&_syn_queue_lock);
+    mutex_lock(&list->lock);
+    int res = _syn_check(ip, src, dst);
+    mutex_unlock(&list->lock);
+    if (res == -ENOTCONN) {
+        mutex_unlock(&_syn_queue_lock);
+        return false;
+    }
+    /* Retransmitted SYN of a connection in the making */
+    if (res == -EALREADY) {
+        mutex_unlock(&_syn_queue_lock);
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+
+    _syn_queue_expire();
+
+    for (num = 0; num < TCP_SYN_QUEUE_SIZE && _syn_queue[num] != NULL; num++) {
+        gnrc_pktsnip_t *held_ip = gnrc_pktsnip_search_type(_syn_queue[num], GNRC_NETTYPE_IPV6);
+        gnrc_pktsnip_t *held_tcp = gnrc_pktsnip_search_type(_syn_queue[num], GNRC_NETTYPE_TCP);
+
+        if (byteorder_ntohs(((tcp_hdr_t *)held_tcp->data)->src_port) == src &&
+            ipv6_addr_equal(&((ipv6_hdr_t *)held_ip->data)->src, &ip->src)) {
+            pos = num;
+        }
+    }
+
+    /* A retransmitted SYN replaces its held copy and restarts its timeout.
+     * If all places are taken, the oldest SYN is dropped, its peer
+     * retransmits it. */
+    if (pos == TCP_SYN_QUEUE_SIZE && num == TCP_SYN_QUEUE_SIZE) {
+        pos = 0;
+    }
+    if (pos < TCP_SYN_QUEUE_SIZE) {
+        gnrc_pktbuf_release(_syn_queue[pos]);
+        _syn_queue_remove(pos);
+        num--;
+    }
+    _syn_queue[num] = pkt;
+    _syn_queue_since[num] = evtimer_now_msec();
+    _syn_queue_sched();
+    mutex_unlock(&_syn_queue_lock);
+    TCP_DEBUG_INFO("Holding SYN until a TCB listens.");
+    return true;
+}
+
+/**
+ * @brief Hands held SYNs to TCBs in LISTEN state.
+ */
+static void _syn_queue_replay(void)
+{
+    TCP_DEBUG_ENTER;
+    unsigned pos = 0;
+
+    mutex_lock(&_syn_queue_lock);
+    _syn_queue_expire();
+    while (pos < TCP_SYN_QUEUE_SIZE && _syn_queue[pos] != NULL) {
+        gnrc_pktsnip_t *pkt = _syn_queue[pos];
+        gnrc_pktsnip_t *ip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+        tcp_hdr_t *hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP)->data;
+        gnrc_tcp_tcb_t *tcb = _find_tcb(ip, 1, byteorder_ntohs(hdr->src_port),
+                                        byteorder_ntohs(hdr->dst_port));
+
+        if (tcb == NULL) {
+            pos++;
+            continue;
+        }
+        _syn_queue_remove(pos);
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+        gnrc_pktbuf_release(pkt);
+    }
+    _syn_queue_sched();
+    mutex_unlock(&_syn_queue_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Drops the oldest held SYNs once they timed out.
+ */
+static void _syn_queue_timeout_expired(void)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&_syn_queue_lock);
+    _syn_queue_expire();
+    _syn_queue_sched();
+    mutex_unlock(&_syn_queue_lock);
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 /**
  * @brief Receive function, receive packet from network layer.
  *
@@ -125,7 +423,6 @@ static int _receive(gnrc_pktsnip_t *pkt)
     uint8_t hdr_size = 0;
     uint8_t syn = 0;
     gnrc_pktsnip_t *ip = NULL;
-    gnrc_pktsnip_t *reset = NULL;
     gnrc_tcp_tcb_t *tcb = NULL;
     tcp_hdr_t *hdr;
 
@@ -208,44 +505,7 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
 
     /* Find TCB to for this packet */
-    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
-    mutex_lock(&list->lock);
-    tcb = list->head;
-    while (tcb) {
-#ifdef MODULE_GNRC_IPV6
-        /* Check if current TCB is fitting for the incoming packet */
-        if (ip->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
-            /* If SYN is set, a connection is listening on that port ... */
-            ipv6_addr_t *tmp_addr = NULL;
-            _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
-            if (syn && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
-                /* ... and local addr is unspec or pre configured */
-                tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
-                    ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
-                    break;
-                }
-            }
-
-            /* If SYN is not set and the ports match ... */
-            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
-                /* .. and the IPv6 addresses match */
-                tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
-                    break;
-                }
-            }
-        }
-#else
-        /* Suppress compiler warnings if TCP is built without network layer */
-        TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-        (void) syn;
-        (void) src;
-        (void) dst;
-#endif
-        tcb = tcb->next;
-    }
-    mutex_unlock(&list->lock);
+    tcb = _find_tcb(ip, syn, src, dst);
 
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
     /* cppcheck-suppress knownConditionTrueFalse
@@ -256,12 +516,15 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
     /* No fitting TCB has been found. Respond with reset */
     else {
+#if TCP_SYN_QUEUE_SIZE
+        /* ... unless the port is listened on and a TCB gets free later */
+        if (syn && _syn_queue_add(pkt, ip->data, src, dst)) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+#endif
         if ((ctl & MSK_RST) != MSK_RST) {
-            _gnrc_tcp_pkt_build_reset_from_pkt(&reset, pkt);
-            if (gnrc_netapi_send(_tcp_eventloop_pid, reset) < 1) {
-                gnrc_pktbuf_release(reset);
-                TCP_DEBUG_ERROR("Can't dispatch to network layer.");
-            }
+            _send_reset(pkt);
         }
         gnrc_pktbuf_release(pkt);
         TCP_DEBUG_ERROR("-ENOTCONN: Unable to find matching TCB.");
@@ -330,15 +593,31 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_TIMEOUT_TIMEWAIT, NULL, NULL, 0);
                 break;
 
-           /* A connection opening attempt from a TCB in listening mode failed.
-            * Clear retransmission and re-open for next attempt */
+           /* A connection opening attempt or a teardown of a TCB in listening
+            * mode failed. Clear retransmission and re-open for next attempt */
             case MSG_TYPE_CONNECTION_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_CONNECTION_TIMEOUT.");
                 _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
                               FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
-                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
-                              FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+                if (((gnrc_tcp_tcb_t *)msg.content.ptr)->status & STATUS_LISTENING) {
+                    _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                                  FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+                }
+                break;
+
+#if TCP_SYN_QUEUE_SIZE
+            /* A TCB listens again: Hand held SYNs to it */
+            case MSG_TYPE_LISTEN:
+                TCP_DEBUG_INFO("Received MSG_TYPE_LISTEN.");
+                _syn_queue_replay();
+                break;
+
+            /* The oldest held SYN timed out */
+            case MSG_TYPE_SYN_TIMEOUT:
+                TCP_DEBUG_INFO("Received MSG_TYPE_SYN_TIMEOUT.");
+                _syn_queue_timeout_expired();
                 break;
+#endif
 
             default:
                 TCP_DEBUG_ERROR("Received unexpected message.");
@@ -368,6 +647,53 @@ void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+void _gnrc_tcp_eventloop_listen(void)
+{
+    TCP_DEBUG_ENTER;
+#if TCP_SYN_QUEUE_SIZE
+    /* Only the event loop replays held SYNs, a SYN held after this check is
+     * retransmitted by its peer */
+    if (_syn_queue[0] != NULL) {
+        msg_t msg = { .type = MSG_TYPE_LISTEN };
+
+        msg_try_send(&msg, _tcp_eventloop_pid);
+    }
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_eventloop_stop_listen(void)
+{
+    TCP_DEBUG_ENTER;
+#if TCP_SYN_QUEUE_SIZE
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    unsigned pos = 0;
+
+    mutex_lock(&_syn_queue_lock);
+    while (pos < TCP_SYN_QUEUE_SIZE && _syn_queue[pos] != NULL) {
+        gnrc_pktsnip_t *pkt = _syn_queue[pos];
+        gnrc_pktsnip_t *ip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+        tcp_hdr_t *hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP)->data;
+
+        mutex_lock(&list->lock);
+        int res = _syn_check(ip->data, byteorder_ntohs(hdr->src_port),
+                             byteorder_ntohs(hdr->dst_port));
+        mutex_unlock(&list->lock);
+        if (res != -ENOTCONN) {
+            pos++;
+            continue;
+        }
+        /* Nobody listens on the port anymore */
+        _syn_queue_remove(pos);
+        _send_reset(pkt);
+        gnrc_pktbuf_release(pkt);
+    }
+    _syn_queue_sched();
+    mutex_unlock(&_syn_queue_lock);
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
 int _gnrc_tcp_eventloop_init(void)
 {
     TCP_DEBUG_ENTER;
@@ -17,14 +17,17 @@
  * @}
  */
 
+#include <assert.h>
 #include <utlist.h>
 #include <errno.h>
+#include <string.h>
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,15 +95,37 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit[0] != NULL) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < ARRAY_SIZE(tcb->pkt_retransmit); i++) {
+            if (tcb->pkt_retransmit[i] != NULL) {
+                gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+                tcb->pkt_retransmit[i] = NULL;
+            }
+            tcb->pkt_sacked[i] = false;
+        }
     }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Counts the selectively acknowledged segments in the retransmit queue.
+ *
+ * @param[in] tcb   TCB holding the retransmit queue.
+ *
+ * @return   Number of selectively acknowledged segments.
+ */
+static unsigned _sacked_segments(const gnrc_tcp_tcb_t *tcb)
+{
+    unsigned num = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(tcb->pkt_sacked); i++) {
+        num += tcb->pkt_sacked[i];
+    }
+    return num;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -159,6 +184,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_DELETE(list->head, tcb);
                 mutex_unlock(&list->lock);
 
+                /* Stop a timeout scheduled while the TCB was listening */
+                _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+
                 /* Free potentially allocated receive buffer */
                 _gnrc_tcp_rcvbuf_release_buffer(tcb);
                 TCP_DEBUG_INFO("Connection closed");
@@ -177,6 +205,15 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear Accepted Status */
             tcb->status &= ~(STATUS_ACCEPTED);
 
+            /* Stop timeout of the previous connection */
+            _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+
+            /* Drop data the previous connection left unread */
+            ringbuffer_remove(&tcb->rcv_buf, tcb->rcv_buf.avail);
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+            tcb->async_cb = NULL;
+#endif
+
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
             if (tcb->address_family == AF_INET6) {
@@ -195,9 +232,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_PREPEND(list->head, tcb);
             }
             mutex_unlock(&list->lock);
+
+            /* Hand over a connection request held while this TCB was busy */
+            _gnrc_tcp_eventloop_listen();
             break;
 
         case FSM_STATE_SYN_SENT:
+            tcb->status &= ~STATUS_ABORTED;
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
@@ -223,6 +264,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_RCVD:
+            tcb->status &= ~STATUS_ABORTED;
             /* Setup timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
@@ -237,6 +279,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
             }
+            /* Start congestion control once the peers MSS is known */
+            if (state == FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_ESTABLISHED) {
+                _gnrc_tcp_congure_init(tcb);
+            }
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
@@ -284,6 +330,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->iss = random_uint32();
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
+        tcb->snd_recover = tcb->iss;
+        tcb->snd_rtx = tcb->iss;
+        tcb->dup_acks = 0;
 
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
@@ -317,27 +366,49 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    uint32_t wnd = _gnrc_tcp_congure_cwnd(tcb);
+
+    /* Usable window is limited by the peers window and the congestion window */
+    wnd = (wnd < tcb->snd_wnd) ? wnd : tcb->snd_wnd;
+
+    /* Send segments while the window is open and the retransmit queue has room */
+    while (sent < len &&
+           tcb->pkt_retransmit[ARRAY_SIZE(tcb->pkt_retransmit) - 1] == NULL) {
+        uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+        size_t full = len - sent;
+        size_t payload;
+
+        if (in_flight >= wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        full = (full < CONFIG_GNRC_TCP_MSS) ? full : CONFIG_GNRC_TCP_MSS;
+        full = (full < tcb->mss) ? full : tcb->mss;
+        payload = wnd - in_flight;
+        payload = (payload < full) ? payload : full;
+
+        /* Avoid silly window syndrome: wait for ACKs instead of sending a
+         * segment shrunk by the window (see RFC 1122, 4.2.3.4) */
+        if (payload < full && in_flight > 0) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        uint16_t ctl = (sent + payload == len) ? (MSK_ACK | MSK_PSH) : MSK_ACK;
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, ctl, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        _gnrc_tcp_congure_report_sent(tcb, payload);
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -397,6 +468,9 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
                             tcb->rcv_nxt, NULL, 0);
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        if (tcb->state != FSM_STATE_SYN_RCVD) {
+            _gnrc_tcp_congure_report_sent(tcb, seq_con);
+        }
     }
 
     if (tcb->state == FSM_STATE_LISTEN) {
@@ -468,7 +542,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
-    /* Parse packet options, return if they are malformed */
+    /* Parse packet options, return if they are malformed. SACK blocks are
+     * applied with the acknowledgment processing below. */
     if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
         TCP_DEBUG_LEAVE;
@@ -572,7 +647,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
+            tcb->snd_recover = tcb->iss;
+            tcb->snd_rtx = tcb->iss;
+            tcb->dup_acks = 0;
             tcb->snd_wnd = seg_wnd;
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
@@ -613,6 +692,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
             tcb->irs = seg_seq;
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
                 _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
@@ -710,10 +790,60 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
+                /* Mark selectively acknowledged segments, if SACK was negotiated */
+                if ((tcb->status & STATUS_SACK_PERMITTED) &&
+                    LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    _gnrc_tcp_option_parse_sack(tcb, tcp_hdr);
+                }
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    /* The SYN was not reported to congestion control */
+                    uint32_t acked = seg_ack - tcb->snd_una - (tcb->snd_una == tcb->iss);
+
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_congure_report_acked(tcb, acked, seg_ack, seg_wnd, pay_len,
+                                                   !(ctl & (MSK_SYN | MSK_FIN)));
+
+                    /* Partial ACK during loss recovery: the next segment got lost too */
+                    if (LSS_32_BIT(seg_ack, tcb->snd_recover)) {
+                        _gnrc_tcp_pkt_retransmit_hole(tcb, false);
+                    }
+                    else {
+                        tcb->snd_recover = seg_ack;
+                    }
+
+                    /* Signal user that the retransmit queue has room again */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* ACK without progress while data is outstanding */
+                else if (seg_ack == tcb->snd_una && tcb->pkt_retransmit[0] != NULL &&
+                         pay_len == 0 && !(ctl & (MSK_SYN | MSK_FIN))) {
+                    /* Duplicate ACK (see RFC 5681 section 2) */
+                    if (seg_wnd == tcb->snd_wnd) {
+                        _gnrc_tcp_congure_report_acked(tcb, 0, seg_ack, seg_wnd, 0, true);
+                        tcb->dup_acks += (tcb->dup_acks < UINT8_MAX);
+                    }
+
+                    /* Fast retransmit once per window, enter loss recovery. Segments
+                     * selectively acknowledged behind the oldest one count like
+                     * duplicate ACKs, even if the window changed (see RFC 6675) */
+                    if (LEQ_32_BIT(tcb->snd_recover, tcb->snd_una) &&
+                        (tcb->dup_acks >= CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD ||
+                         _sacked_segments(tcb) >= CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD)) {
+                        if (tcb->dup_acks < CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD) {
+                            _gnrc_tcp_congure_report_lost(
+                                tcb, _gnrc_tcp_pkt_get_pay_len(tcb->pkt_retransmit[0]));
+                        }
+                        tcb->snd_recover = tcb->snd_nxt;
+                        tcb->snd_rtx = tcb->snd_una;
+                        _gnrc_tcp_pkt_retransmit_hole(tcb, false);
+                    }
+                    /* During recovery, resend further holes revealed by SACK blocks */
+                    else if (LSS_32_BIT(tcb->snd_una, tcb->snd_recover)) {
+                        _gnrc_tcp_pkt_retransmit_hole(tcb, true);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +868,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,16 +902,19 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
+                uint32_t seq = seg_seq;
+                uint32_t added = 0;
+
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                /* Copy contents into receive buffer, data behind a gap is kept for later */
+                while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                    added += _gnrc_tcp_rcvbuf_add(tcb, seq, snp->data, snp->size);
+                    seq += snp->size;
+                    snp = snp->next;
+                }
+                if (added > 0) {
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
@@ -803,6 +936,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Ignore FIN until all data before it was received, the peer resends it */
+            if (tcb->rcv_nxt != seg_seq + pay_len) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +954,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit[0] == NULL) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +998,28 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit[0] != NULL) {
+        /* Give up on the connection if the peer stopped acknowledging */
+        if (evtimer_now_msec() - tcb->rtx_since >=
+            CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS) {
+            TCP_DEBUG_INFO("Connection timed out, abort.");
+            tcb->status |= STATUS_ABORTED | STATUS_NOTIFY_USER;
+            _fsm_call_abort(tcb);
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+        /* Congestion control starts with the established connection */
+        if (tcb->state != FSM_STATE_SYN_SENT && tcb->state != FSM_STATE_SYN_RCVD) {
+            _gnrc_tcp_congure_report_timeout(tcb, tcb->snd_nxt - tcb->snd_una);
+        }
+        /* Segments behind the oldest one are likely lost as well, SACK
+         * information may be outdated (see RFC 2018, section 8) */
+        tcb->snd_recover = tcb->snd_nxt;
+        tcb->snd_rtx = tcb->snd_una;
+        tcb->dup_acks = 0;
+        memset(tcb->pkt_sacked, 0, sizeof(tcb->pkt_sacked));
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -878,7 +1038,10 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    _transition_to(tcb, FSM_STATE_CLOSED);
+    /* The retransmission timer may have aborted the connection already */
+    if (tcb->state != FSM_STATE_CLOSED) {
+        _transition_to(tcb, FSM_STATE_CLOSED);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -978,12 +1141,94 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     return ret;
 }
 
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+/**
+ * @brief Checks if data can be queued for transmission without waiting.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   True if gnrc_tcp_send() would return without blocking.
+ */
+static bool _writable(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = _gnrc_tcp_congure_cwnd(tcb);
+
+    wnd = (wnd < tcb->snd_wnd) ? wnd : tcb->snd_wnd;
+    return (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) &&
+           tcb->pkt_retransmit[ARRAY_SIZE(tcb->pkt_retransmit) - 1] == NULL &&
+           (tcb->snd_nxt - tcb->snd_una) < wnd;
+}
+
+/**
+ * @brief Derives the asynchronous events of a connection from an FSM call.
+ *
+ * @param[in] tcb       TCB after the FSM call.
+ * @param[in] state     Connection state before the FSM call.
+ * @param[in] avail     Number of readable bytes before the FSM call.
+ * @param[in] snd_una   Oldest unacknowledged sequence number before the FSM call.
+ *
+ * @returns   Events for the callback of @p tcb. The listening queue of @p tcb
+ *            is notified with SOCK_ASYNC_CONN_RECV instead of SOCK_ASYNC_CONN_RDY.
+ */
+static unsigned _async_events(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state,
+                              unsigned avail, uint32_t snd_una)
+{
+    _gnrc_tcp_fsm_state_t now = tcb->state;
+    unsigned flags = 0;
+
+    /* Handshake completed */
+    if ((state == FSM_STATE_SYN_SENT || state == FSM_STATE_SYN_RCVD) &&
+        (now == FSM_STATE_ESTABLISHED || now == FSM_STATE_CLOSE_WAIT)) {
+        flags |= SOCK_ASYNC_CONN_RDY;
+    }
+    /* FIN received, connection reset or timed out */
+    if ((now == FSM_STATE_CLOSE_WAIT && state != FSM_STATE_CLOSE_WAIT) ||
+        ((now == FSM_STATE_CLOSED || now == FSM_STATE_LISTEN) &&
+         (state == FSM_STATE_SYN_SENT || state == FSM_STATE_ESTABLISHED ||
+          state == FSM_STATE_CLOSE_WAIT))) {
+        flags |= SOCK_ASYNC_CONN_FIN;
+    }
+    if ((now == FSM_STATE_ESTABLISHED || now == FSM_STATE_FIN_WAIT_1 ||
+         now == FSM_STATE_FIN_WAIT_2 || now == FSM_STATE_CLOSE_WAIT) &&
+        tcb->rcv_buf.avail > avail) {
+        flags |= SOCK_ASYNC_MSG_RECV;
+    }
+    if (tcb->snd_una != snd_una && _writable(tcb)) {
+        flags |= SOCK_ASYNC_MSG_SENT;
+    }
+    return flags;
+}
+
+/* _gnrc_tcp_fsm() tells the user's calls from events of the peer and timers
+ * by their order */
+static_assert((FSM_EVENT_CALL_OPEN < FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_CALL_SEND < FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_CALL_RECV < FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_CALL_CLOSE < FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_CALL_ABORT < FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_TIMEOUT_TIMEWAIT > FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_TIMEOUT_RETRANSMIT > FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_TIMEOUT_CONNECTION > FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_SEND_PROBE > FSM_EVENT_RCVD_PKT) &&
+              (FSM_EVENT_CLEAR_RETRANSMIT > FSM_EVENT_RCVD_PKT),
+              "user calls must precede FSM_EVENT_RCVD_PKT, other events follow it");
+#endif
+
 int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
                   gnrc_pktsnip_t *in_pkt, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    _gnrc_tcp_fsm_state_t state = tcb->state;
+    unsigned avail = tcb->rcv_buf.avail;
+    uint32_t snd_una = tcb->snd_una;
+    sock_tcp_cb_t cb = tcb->async_cb;
+    void *cb_arg = tcb->async_cb_arg;
+    gnrc_tcp_tcb_queue_t *queue = tcb->queue;
+    unsigned flags = 0;
+#endif
 
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
@@ -996,8 +1241,28 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         msg.content.ptr = tcb;
         mbox_try_put(tcb->mbox, &msg);
     }
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    /* Only the peer and timers cause asynchronous events, not the user's calls */
+    if (event >= FSM_EVENT_RCVD_PKT) {
+        flags = _async_events(tcb, state, avail, snd_una);
+    }
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
+
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    /* A listening queue is notified of new connections, the user sets the
+     * callback of the connection after accepting it */
+    if ((flags & SOCK_ASYNC_CONN_RDY) && queue != NULL) {
+        if (queue->async_cb) {
+            queue->async_cb(queue, SOCK_ASYNC_CONN_RECV, queue->async_cb_arg);
+        }
+        flags &= ~SOCK_ASYNC_CONN_RDY;
+    }
+    if (flags && cb) {
+        cb(tcb, flags, cb_arg);
+    }
+#endif
     TCP_DEBUG_LEAVE;
     return result;
 }
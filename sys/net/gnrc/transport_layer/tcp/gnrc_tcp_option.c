@@ -18,6 +18,7 @@
  */
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -26,7 +27,13 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    uint8_t offset = GET_OFFSET(ctl);
+
+    /* SACK is permitted for the connection if the peers SYN says so */
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~STATUS_SACK_PERMITTED;
+    }
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +71,31 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (ctl & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                /* Blocks are applied once the segment was accepted */
+                TCP_DEBUG_INFO("SACK option found.");
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -83,3 +115,35 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+void _gnrc_tcp_option_parse_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
+    uint8_t opt_left = (offset > TCP_HDR_OFFSET_MIN) ? (offset - TCP_HDR_OFFSET_MIN) * 4 : 0;
+
+    /* Options were validated by _gnrc_tcp_option_parse() */
+    while (opt_left > 0) {
+        tcp_hdr_opt_t *option = (tcp_hdr_opt_t *) opt_ptr;
+
+        if (option->kind == TCP_OPTION_KIND_EOL) {
+            break;
+        }
+        if (option->kind == TCP_OPTION_KIND_NOP) {
+            opt_ptr += 1;
+            opt_left -= 1;
+            continue;
+        }
+        if (option->kind == TCP_OPTION_KIND_SACK) {
+            for (uint8_t *blk = option->value; blk < opt_ptr + option->length;
+                 blk += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                _gnrc_tcp_pkt_sacked(tcb, _gnrc_tcp_option_get_u32(blk),
+                                     _gnrc_tcp_option_get_u32(blk + 4));
+            }
+        }
+        opt_ptr += option->length;
+        opt_left -= option->length;
+    }
+    TCP_DEBUG_LEAVE;
+}
@@ -155,6 +155,9 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+    unsigned sack_blocks = 0;
+#endif
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -177,10 +180,19 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    /* Add MSS and SACK permitted option if SYN is sent */
     if (ctl & MSK_SYN) {
-        offset += 1;
+        offset += 2;
+    }
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+    /* Add SACK option if out-of-order data was received and the peer allows it */
+    else if ((ctl & MSK_ACK) && (tcb->status & STATUS_SACK_PERMITTED) &&
+             tcb->rcv_ooo_num > 0) {
+        sack_blocks = (tcb->rcv_ooo_num < GNRC_TCP_OPTION_SACK_BLOCKS_MAX)
+                    ? tcb->rcv_ooo_num : GNRC_TCP_OPTION_SACK_BLOCKS_MAX;
+        offset += 1 + 2 * sack_blocks;
     }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -211,14 +223,36 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
+            /* If SYN flag is set: Add MSS and SACK permitted option */
             if (ctl & MSK_SYN) {
                 network_uint32_t mss_option = byteorder_htonl(
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+            /* Add SACK option, most recently received ranges first */
+            if (sack_blocks > 0) {
+                network_uint32_t sack_hdr = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_hdr(sack_blocks));
+
+                memcpy(opt_ptr, &sack_hdr, sizeof(sack_hdr));
+                opt_ptr += sizeof(sack_hdr);
+                for (unsigned i = 0; i < sack_blocks; i++) {
+                    network_uint32_t edge = byteorder_htonl(tcb->rcv_ooo[i].start);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                    edge = byteorder_htonl(tcb->rcv_ooo[i].end);
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
+            }
+#endif
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -285,14 +319,20 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number and measure time
+     * of one segment per round trip */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_TIMING)) {
+            tcb->status |= STATUS_RTT_TIMING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = evtimer_now_msec();
+        }
     }
     else {
+        /* Any retransmission makes the running measurement ambiguous (Karns Algorithm) */
         tcb->retries += 1;
+        tcb->status &= ~STATUS_RTT_TIMING;
     }
 
     /* Pass packet down the network stack */
@@ -376,6 +416,60 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Restarts the retransmission timer for the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag used to indicate that the timer expired before.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb, const bool backoff)
+{
+    /* RTO adjustment */
+    if (!backoff) {
+        /* If there is no measurement yet: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Fire no later than the connection is given up on */
+    uint32_t offset = tcb->rto;
+    uint32_t waited = evtimer_now_msec() - tcb->rtx_since;
+
+    if (waited + offset > CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS) {
+        offset = (waited < CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS)
+               ? CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS - waited : 0;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, offset,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -383,6 +477,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
+    unsigned pos = 0;
 
     /* No packet received */
     if (pkt == NULL) {
@@ -391,11 +486,23 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+    /* Only the oldest segment is retransmitted by the timer */
+    if (retransmit && tcb->pkt_retransmit[0] != pkt) {
+        TCP_DEBUG_ERROR("-EINVAL: pkt is not the oldest unacknowledged segment.");
         TCP_DEBUG_LEAVE;
-        return -ENOMEM;
+        return -EINVAL;
+    }
+
+    /* Find the end of the retransmit queue */
+    if (!retransmit) {
+        while (pos < ARRAY_SIZE(tcb->pkt_retransmit) && tcb->pkt_retransmit[pos] != NULL) {
+            pos++;
+        }
+        if (pos == ARRAY_SIZE(tcb->pkt_retransmit)) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
     }
 
     /* Extract control bits and segment length */
@@ -416,43 +523,17 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    tcb->pkt_retransmit[pos] = pkt;
+    tcb->pkt_sacked[pos] = false;
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
-    }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
+    /* The timer only runs for the oldest segment */
+    if (pos == 0) {
+        if (!retransmit) {
+            tcb->rtx_since = evtimer_now_msec();
         }
+        _sched_retransmit(tcb, retransmit);
     }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -463,38 +544,57 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
     uint32_t seg = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
+    unsigned acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit[0] == NULL) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
+    /* Release all segments that are covered by ack, the queue is ordered */
+    while (acked < ARRAY_SIZE(tcb->pkt_retransmit) && tcb->pkt_retransmit[acked] != NULL) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[acked], GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[acked]) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
     }
 
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Move remaining segments to the front */
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            (ARRAY_SIZE(tcb->pkt_retransmit) - acked) * sizeof(tcb->pkt_retransmit[0]));
+    memset(&tcb->pkt_retransmit[ARRAY_SIZE(tcb->pkt_retransmit) - acked], 0,
+           acked * sizeof(tcb->pkt_retransmit[0]));
+    memmove(tcb->pkt_sacked, &tcb->pkt_sacked[acked],
+            (ARRAY_SIZE(tcb->pkt_sacked) - acked) * sizeof(tcb->pkt_sacked[0]));
+    memset(&tcb->pkt_sacked[ARRAY_SIZE(tcb->pkt_sacked) - acked], 0,
+           acked * sizeof(tcb->pkt_sacked[0]));
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_TIMING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_TIMING;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -509,6 +609,102 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart or stop the retransmission timer */
+    if (tcb->pkt_retransmit[0] != NULL) {
+        tcb->rtx_since = evtimer_now_msec();
+        _sched_retransmit(tcb, false);
+    }
+    else {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+/**
+ * @brief Gets the sequence numbers occupied by a segment.
+ *
+ * @param[in]  pkt     Segment to examine.
+ * @param[out] range   Sequence numbers occupied by @p pkt.
+ *
+ * @returns   Zero on success.
+ *            -EINVAL if @p pkt contains no TCP header.
+ */
+static int _get_seq_range(gnrc_pktsnip_t *pkt, gnrc_tcp_seq_range_t *range)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    if (snp == NULL) {
+        return -EINVAL;
+    }
+    range->start = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    range->end = range->start + _gnrc_tcp_pkt_get_seg_len(pkt);
+    return 0;
+}
+
+void _gnrc_tcp_pkt_sacked(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_seq_range_t seg;
+
+    /* Ignore blocks of data that was not sent or is acknowledged already */
+    if (!LSS_32_BIT(left, right) || LSS_32_BIT(left, tcb->snd_una) ||
+        LSS_32_BIT(tcb->snd_nxt, right)) {
+        TCP_DEBUG_ERROR("Invalid SACK block.");
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* Mark all segments that are completely covered by the block */
+    for (unsigned i = 0; i < ARRAY_SIZE(tcb->pkt_retransmit) &&
+         tcb->pkt_retransmit[i] != NULL; i++) {
+        if (_get_seq_range(tcb->pkt_retransmit[i], &seg) == 0 &&
+            LEQ_32_BIT(left, seg.start) && LEQ_32_BIT(seg.end, right)) {
+            tcb->pkt_sacked[i] = true;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_pkt_retransmit_hole(gnrc_tcp_tcb_t *tcb, const bool sacked_above)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_seq_range_t seg;
+    gnrc_tcp_seq_range_t hole_seg = { 0 };
+    gnrc_pktsnip_t *hole = NULL;
+    bool found = false;
+
+    /* Find the oldest segment that was neither selectively acknowledged nor
+     * retransmitted during this recovery, optionally followed by a SACKed one */
+    for (unsigned i = 0; i < ARRAY_SIZE(tcb->pkt_retransmit) &&
+         tcb->pkt_retransmit[i] != NULL; i++) {
+        if (tcb->pkt_sacked[i]) {
+            if (hole != NULL) {
+                found = true;
+                break;
+            }
+        }
+        else if (hole == NULL && _get_seq_range(tcb->pkt_retransmit[i], &seg) == 0 &&
+                 LEQ_32_BIT(tcb->snd_rtx, seg.start)) {
+            hole = tcb->pkt_retransmit[i];
+            hole_seg = seg;
+            if (!sacked_above) {
+                found = true;
+                break;
+            }
+        }
+    }
+
+    if (!found) {
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(hole, 1);
+    _gnrc_tcp_pkt_send(tcb, hole, 0, true);
+    tcb->snd_rtx = hole_seg.end;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -18,6 +18,7 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -124,3 +125,165 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+/**
+ * @brief Copy data behind the readable part of the receive buffer.
+ *
+ * The data does not become readable. This relies on the read position of the
+ * ringbuffer staying in place, which holds as only ringbuffer_get() is used
+ * to read from it.
+ *
+ * @param[in,out] rb       Receive buffer.
+ * @param[in]     offset   Offset behind the readable part.
+ * @param[in]     data     Data to copy.
+ * @param[in]     len      Number of bytes in @p data.
+ */
+static void _rcvbuf_write(ringbuffer_t *rb, unsigned offset, const uint8_t *data,
+                          unsigned len)
+{
+    unsigned pos = (rb->start + rb->avail + offset) % rb->size;
+    unsigned till_end = rb->size - pos;
+
+    if (len <= till_end) {
+        memcpy(rb->buf + pos, data, len);
+    }
+    else {
+        memcpy(rb->buf + pos, data, till_end);
+        memcpy(rb->buf, data + till_end, len - till_end);
+    }
+}
+
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+/**
+ * @brief Remove an out-of-order range.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order ranges.
+ * @param[in]     idx   Index of the range to remove.
+ */
+static void _ooo_remove(gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+    tcb->rcv_ooo_num--;
+    memmove(&tcb->rcv_ooo[idx], &tcb->rcv_ooo[idx + 1],
+            (tcb->rcv_ooo_num - idx) * sizeof(tcb->rcv_ooo[0]));
+}
+
+/**
+ * @brief Record out-of-order data, merging it with overlapping or adjacent ranges.
+ *
+ * @param[in,out] tcb     TCB holding the out-of-order ranges.
+ * @param[in]     start   First sequence number of the data.
+ * @param[in]     end     Sequence number following the data.
+ */
+static void _ooo_insert(gnrc_tcp_tcb_t *tcb, uint32_t start, uint32_t end)
+{
+    unsigned i = 0;
+
+    while (i < tcb->rcv_ooo_num) {
+        gnrc_tcp_seq_range_t *r = &tcb->rcv_ooo[i];
+
+        if (LEQ_32_BIT(r->start, end) && LEQ_32_BIT(start, r->end)) {
+            start = LSS_32_BIT(r->start, start) ? r->start : start;
+            end = LSS_32_BIT(end, r->end) ? r->end : end;
+            _ooo_remove(tcb, i);
+        }
+        else {
+            i++;
+        }
+    }
+    if (tcb->rcv_ooo_num == CONFIG_GNRC_TCP_RCV_OOO_RANGES) {
+        TCP_DEBUG_INFO("No free out-of-order range, drop data.");
+        return;
+    }
+
+    /* The most recently updated range is reported first (see RFC 2018, section 4) */
+    memmove(&tcb->rcv_ooo[1], &tcb->rcv_ooo[0], tcb->rcv_ooo_num * sizeof(tcb->rcv_ooo[0]));
+    tcb->rcv_ooo[0].start = start;
+    tcb->rcv_ooo[0].end = end;
+    tcb->rcv_ooo_num++;
+}
+
+/**
+ * @brief Take out-of-order data that became contiguous with in-sequence data.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order ranges.
+ * @param[in]     end   Sequence number following the in-sequence data.
+ *
+ * @returns   Sequence number following the contiguous data.
+ */
+static uint32_t _ooo_take(gnrc_tcp_tcb_t *tcb, uint32_t end)
+{
+    unsigned i = 0;
+
+    while (i < tcb->rcv_ooo_num) {
+        gnrc_tcp_seq_range_t *r = &tcb->rcv_ooo[i];
+
+        if (LEQ_32_BIT(r->start, end)) {
+            end = LSS_32_BIT(end, r->end) ? r->end : end;
+            _ooo_remove(tcb, i);
+            /* The range may close the gap to one that was checked before */
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
+    return end;
+}
+#endif
+
+uint32_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const void *data,
+                              size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    const uint8_t *ptr = data;
+    uint32_t end = seq + len;
+    uint32_t buf_end = tcb->rcv_nxt + ringbuffer_get_free(rb);
+    uint32_t added;
+
+    /* Trim data received before and data not fitting into the buffer */
+    if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+        ptr += tcb->rcv_nxt - seq;
+        seq = tcb->rcv_nxt;
+    }
+    if (LSS_32_BIT(buf_end, end)) {
+        end = buf_end;
+    }
+    if (LEQ_32_BIT(end, seq)) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+    _rcvbuf_write(rb, seq - tcb->rcv_nxt, ptr, end - seq);
+    if (seq != tcb->rcv_nxt) {
+        _ooo_insert(tcb, seq, end);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    end = _ooo_take(tcb, end);
+#else
+    if (seq != tcb->rcv_nxt) {
+        TCP_DEBUG_INFO("Out-of-order data, drop it.");
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    _rcvbuf_write(rb, 0, ptr, end - seq);
+#endif
+
+    /* Make contiguous data readable */
+    added = end - tcb->rcv_nxt;
+    rb->avail += added;
+    tcb->rcv_nxt = end;
+    TCP_DEBUG_LEAVE;
+    return added;
+}
+
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+#if CONFIG_GNRC_TCP_RCV_OOO_RANGES
+    tcb->rcv_ooo_num = 0;
+#else
+    (void)tcb;
+#endif
+}
@@ -46,6 +46,9 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_TIMING     (1 << 5) /**< Internal: Status bitmask RTT_TIMING */
+#define STATUS_SACK_PERMITTED (1 << 6) /**< Internal: Status bitmask SACK_PERMITTED */
+#define STATUS_ABORTED        (1 << 7) /**< Internal: Status bitmask ABORTED */
 /** @} */
 
 /**
@@ -85,6 +88,8 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_LISTEN             (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
+#define MSG_TYPE_SYN_TIMEOUT        (GNRC_NETAPI_MSG_TYPE_ACK + 108) /**< Internal: message id */
 /** @} */
 
 /**
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control for GNRC TCP using @ref sys_congure
+ *
+ * All functions are no-ops and the congestion window is unlimited when
+ * module `gnrc_tcp_congure` is not used.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "clist.h"
+#include "congure.h"
+#include "evtimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief Sets up and initializes the congestion control state of a TCB.
+ *
+ * @param[in,out] tcb   TCB of a connection that just got established.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+#else
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+#endif
+
+/**
+ * @brief Gets the congestion window of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Congestion window in bytes.
+ */
+static inline uint32_t _gnrc_tcp_congure_cwnd(const gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    return tcb->congure.super.cwnd;
+#else
+    (void)tcb;
+    return UINT32_MAX;
+#endif
+}
+
+/**
+ * @brief Reports a newly sent segment to the congestion control.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Payload length of the segment.
+ */
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb,
+                                                 unsigned len)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+
+    c->driver->report_msg_sent(c, len);
+#else
+    (void)tcb;
+    (void)len;
+#endif
+}
+
+/**
+ * @brief Reports a new or a duplicate ACK to the congestion control.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     acked     Number of bytes newly acknowledged, 0 for duplicates.
+ * @param[in]     ack       Acknowledgment number of the ACK.
+ * @param[in]     wnd       Window advertised with the ACK.
+ * @param[in]     pay_len   Payload length of the ACK.
+ * @param[in]     clean     True if neither SYN nor FIN is set on the ACK.
+ */
+static inline void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb,
+                                                  uint32_t acked, uint32_t ack,
+                                                  uint16_t wnd, uint32_t pay_len,
+                                                  bool clean)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+    /* data reported lost on a timeout is not in flight anymore */
+    congure_snd_msg_t msg = {
+        .size = (acked < tcb->congure.in_flight_size) ? acked : tcb->congure.in_flight_size,
+        .resends = tcb->retries,
+    };
+    congure_snd_ack_t ack_info = {
+        .recv_time = evtimer_now_msec(),
+        .id = ack,
+        .size = pay_len,
+        .wnd = wnd,
+        .clean = clean,
+    };
+
+    c->driver->report_msg_acked(c, &msg, &ack_info);
+#else
+    (void)tcb;
+    (void)acked;
+    (void)ack;
+    (void)wnd;
+    (void)pay_len;
+    (void)clean;
+#endif
+}
+
+/**
+ * @brief Reports an expired retransmission timer to the congestion control.
+ *
+ * Losses detected by duplicate ACKs are not reported here, the congestion
+ * control detects them from the ACKs reported with
+ * @ref _gnrc_tcp_congure_report_acked.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of bytes in flight.
+ */
+static inline void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb,
+                                                    unsigned len)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+    congure_snd_msg_t msg = { .size = len, .resends = tcb->retries };
+    clist_node_t msgs = { NULL };
+
+    clist_rpush(&msgs, &msg.super);
+    c->driver->report_msgs_timeout(c, (congure_snd_msg_t *)&msgs);
+#else
+    (void)tcb;
+    (void)len;
+#endif
+}
+
+/**
+ * @brief Reports the oldest segment as lost to the congestion control.
+ *
+ * Only used if the loss was detected by selective acknowledgments before
+ * enough duplicate ACKs were reported with @ref _gnrc_tcp_congure_report_acked.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Payload length of the lost segment.
+ */
+static inline void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb, unsigned len)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+    congure_snd_msg_t msg = { .size = len, .resends = tcb->retries };
+    clist_node_t msgs = { NULL };
+
+    clist_rpush(&msgs, &msg.super);
+    c->driver->report_msgs_lost(c, (congure_snd_msg_t *)&msgs);
+#else
+    (void)tcb;
+    (void)len;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -57,6 +57,22 @@ void _gnrc_tcp_eventloop_sched(evtimer_msg_event_t *event, uint32_t offset,
  */
 void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event);
 
+/**
+ * @brief   Signal the event loop that a TCB entered LISTEN state
+ *
+ * Connection requests held while all TCBs of a listening queue were busy are
+ * handed to the listening TCB by the event loop. Does not block.
+ */
+void _gnrc_tcp_eventloop_listen(void);
+
+/**
+ * @brief   Drop connection requests held for ports nobody listens on anymore
+ *
+ * The dropped connection requests are answered with a reset. Must be called
+ * after the TCBs of a listening queue were closed.
+ */
+void _gnrc_tcp_eventloop_stop_listen(void);
+
 #ifdef __cplusplus
 }
 #endif
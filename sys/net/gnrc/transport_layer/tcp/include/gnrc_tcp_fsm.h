@@ -47,6 +47,9 @@ typedef enum {
 
 /**
  *  @brief Events that trigger transitions in TCP FSM.
+ *
+ *  User function calls come first, events caused by the peer or timers
+ *  start with FSM_EVENT_RCVD_PKT.
  */
 typedef enum {
     FSM_EVENT_CALL_OPEN,          /* User function call: open */
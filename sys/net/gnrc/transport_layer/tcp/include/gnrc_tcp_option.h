@@ -28,6 +28,13 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of SACK blocks sent in one segment.
+ *
+ * Four blocks fill 36 of the 40 bytes of option space (see RFC 2018, section 3).
+ */
+#define GNRC_TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -41,6 +48,46 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK permitted option, preceded by two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the header of a SACK option, preceded by two NOPs.
+ *
+ * @param[in] nblocks   Number of SACK blocks following the header.
+ *
+ * @returns   SACK option header value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_hdr(unsigned nblocks)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + nblocks * TCP_OPTION_LENGTH_SACK_BLOCK));
+}
+
+/**
+ * @brief Helper function to read an unaligned 32 bit value in network byte order.
+ *
+ * @param[in] buf   Buffer holding the value.
+ *
+ * @returns   Value in host byte order.
+ */
+static inline uint32_t _gnrc_tcp_option_get_u32(const uint8_t *buf)
+{
+    return ((uint32_t) buf[0] << 24) | ((uint32_t) buf[1] << 16) |
+           ((uint32_t) buf[2] << 8) | buf[3];
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -66,6 +113,16 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
  */
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Applies the SACK blocks of a given TCP header to the retransmit queue.
+ *
+ * @pre The options of @p hdr were validated by _gnrc_tcp_option_parse().
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     hdr   TCP header of an accepted segment with an acceptable ACK.
+ */
+void _gnrc_tcp_option_parse_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+
 #ifdef __cplusplus
 }
 #endif
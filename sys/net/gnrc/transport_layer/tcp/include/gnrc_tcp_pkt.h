@@ -110,19 +110,29 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * New packets are appended to the retransmission queue. The retransmission
+ * timer always runs for the oldest packet in the queue.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit
+ *                             of the oldest packet in the queue after its timer
+ *                             expired. The timer is restarted with backoff.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or @p retransmit is set and @p pkt is not
+ *            the oldest packet in the queue.
  */
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * Releases all packets covered by @p ack, takes an RTT sample if the timed
+ * segment got acknowledged and restarts the retransmission timer for the
+ * remaining packets.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -132,6 +142,33 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission queue as selectively acknowledged.
+ *
+ * Blocks outside of the sent, unacknowledged data are ignored.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of a SACK block.
+ * @param[in]     right   Right edge of a SACK block.
+ */
+void _gnrc_tcp_pkt_sacked(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Retransmits the next packet assumed lost during loss recovery.
+ *
+ * This is the oldest packet that was neither selectively acknowledged nor
+ * retransmitted since tcb->snd_rtx was reset. tcb->snd_rtx is advanced
+ * past the retransmitted packet.
+ *
+ * @param[in,out] tcb            TCB holding the connection information.
+ * @param[in]     sacked_above   Only retransmit a packet if a later one was
+ *                               selectively acknowledged.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is no such packet.
+ */
+int _gnrc_tcp_pkt_retransmit_hole(gnrc_tcp_tcb_t *tcb, const bool sacked_above);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -19,6 +19,8 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stddef.h>
+#include <stdint.h>
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +49,31 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Store received data in the receive buffer.
+ *
+ * Data that continues the in-sequence data becomes readable and advances
+ * tcb->rcv_nxt, together with out-of-order data it connects to. Data ahead of
+ * a gap is kept as out-of-order range, if @ref CONFIG_GNRC_TCP_RCV_OOO_RANGES
+ * allows. Data received before or not fitting into the buffer is ignored.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     seq    Sequence number of the first byte in @p data.
+ * @param[in]     data   Received data.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Number of bytes that became readable.
+ */
+uint32_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const void *data,
+                              size_t len);
+
+/**
+ * @brief Forget all out-of-order data of a connection.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,284 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_resmon
+ * @{
+ *
+ * @file
+ * @brief       Resource monitor implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "event/periodic_callback.h"
+#include "event/thread.h"
+#include "resmon.h"
+#include "schedstatistics.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* fractional bits of the averaged load values */
+#define LOAD_SHIFT          (6U)
+
+typedef struct {
+    const thread_t *thread;             /* detects a PID being reused */
+    bool valid;                         /* first sample was taken */
+    uint64_t runtime_us;                /* runtime at the last sample */
+    uint32_t load[RESMON_WINDOW_NUMOF]; /* per mille << LOAD_SHIFT */
+    unsigned free_words;                /* stack words never touched */
+    unsigned scan_pos;                  /* next stack word to check */
+} _thread_stats_t;
+
+static const uint16_t _windows[RESMON_WINDOW_NUMOF] = {
+    CONFIG_RESMON_WINDOW_SHORT,
+    CONFIG_RESMON_WINDOW_MEDIUM,
+    CONFIG_RESMON_WINDOW_LONG,
+};
+
+static _thread_stats_t _threads[KERNEL_PID_LAST + 1];
+static uint32_t _last_sample;
+static uint16_t _seq;
+
+static resmon_export_cb_t _export_cb;
+static void *_export_arg;
+static uint8_t _record[RESMON_RECORD_SIZE(KERNEL_PID_LAST + 1)];
+
+static event_periodic_callback_t _event;
+
+static void _average(uint32_t *load, uint32_t busy_us, uint32_t period_us)
+{
+    uint32_t sample = (uint32_t)(((uint64_t)busy_us * 1000) / period_us);
+
+    if (sample > 1000) {
+        sample = 1000;
+    }
+    sample <<= LOAD_SHIFT;
+    for (unsigned i = 0; i < RESMON_WINDOW_NUMOF; i++) {
+        /* exponential moving average, approximating a window of the given
+         * number of samples */
+        load[i] = (int32_t)load[i] + ((int32_t)(sample - load[i]) / _windows[i]);
+    }
+}
+
+static inline bool _canary(const uintptr_t *word)
+{
+    return *word == (uintptr_t)word;
+}
+
+static void _scan_stack(const thread_t *thread, _thread_stats_t *stats)
+{
+    /* thread_create() aligned the stack, so silencing -Wcast-align is fine */
+    const uintptr_t *stack = (const uintptr_t *)(uintptr_t)thread_get_stackstart(thread);
+    unsigned budget = CONFIG_RESMON_STACK_SCAN_WORDS;
+    uintptr_t sp = (uintptr_t)thread_get_sp(thread);
+
+    /* everything above the saved stack pointer is in use */
+    if ((sp > (uintptr_t)stack) && (sp < (uintptr_t)&stack[stats->free_words])) {
+        stats->free_words = (sp - (uintptr_t)stack) / sizeof(uintptr_t);
+    }
+
+    /* the stack usually grows contiguously, so follow the used words down
+     * from the current high-water mark */
+    while ((budget > 0) && (stats->free_words > 0) &&
+           !_canary(&stack[stats->free_words - 1])) {
+        stats->free_words--;
+        budget--;
+    }
+
+    /* with the remaining budget, continue a pass up from the bottom of the
+     * stack, as e.g. uninitialized arrays leave some words untouched */
+    while ((budget > 0) && (stats->scan_pos < stats->free_words)) {
+        if (!_canary(&stack[stats->scan_pos])) {
+            stats->free_words = stats->scan_pos;
+            break;
+        }
+        stats->scan_pos++;
+        budget--;
+    }
+    if (stats->scan_pos >= stats->free_words) {
+        /* pass complete, start over from the bottom of the stack */
+        stats->scan_pos = 0;
+    }
+}
+
+static uint64_t _runtime(kernel_pid_t pid, uint32_t now)
+{
+    uint64_t runtime = sched_pidlist[pid].runtime_us;
+
+    /* the runtime of the running thread is only updated when it is
+     * scheduled away */
+    if (pid == thread_getpid()) {
+        runtime += now - sched_pidlist[pid].laststart;
+    }
+    return runtime;
+}
+
+static void _sample_thread(kernel_pid_t pid, uint32_t now, uint32_t period)
+{
+    _thread_stats_t *stats = &_threads[pid];
+    const thread_t *thread = thread_get(pid);
+
+    if (!stats->valid || (stats->thread != thread)) {
+        /* new thread, start from scratch */
+        memset(stats, 0, sizeof(*stats));
+        stats->valid = true;
+        stats->thread = thread;
+        stats->runtime_us = _runtime(pid, now);
+        if (thread != NULL) {
+            stats->free_words = thread_get_stacksize(thread) / sizeof(uintptr_t);
+        }
+        return;
+    }
+
+    uint64_t runtime = _runtime(pid, now);
+    _average(stats->load, runtime - stats->runtime_us, period);
+    stats->runtime_us = runtime;
+
+    if ((thread != NULL) && (thread_get_stacksize(thread) > 0)) {
+        _scan_stack(thread, stats);
+    }
+}
+
+static bool _pid_reported(kernel_pid_t pid)
+{
+    if (pid == KERNEL_PID_UNDEF) {
+        return !IS_USED(MODULE_CORE_IDLE_THREAD);
+    }
+    return thread_get(pid) != NULL;
+}
+
+void resmon_sample(void)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint32_t period = now - _last_sample;
+
+    if (period == 0) {
+        return;
+    }
+    _last_sample = now;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (_pid_reported(pid)) {
+            _sample_thread(pid, now, period);
+        }
+    }
+    _seq++;
+
+    if (_export_cb != NULL) {
+        ssize_t len = resmon_get_record(_record, sizeof(_record));
+        if (len > 0) {
+            _export_cb(_record, len, _export_arg);
+        }
+    }
+}
+
+static void _sample_cb(void *arg)
+{
+    (void)arg;
+    resmon_sample();
+}
+
+void resmon_init(void)
+{
+    _last_sample = ztimer_now(ZTIMER_USEC);
+    event_periodic_callback_create(&_event, ZTIMER_MSEC, CONFIG_RESMON_PERIOD_MS,
+                                   EVENT_PRIO_LOWEST, _sample_cb, NULL);
+}
+
+void resmon_set_export_cb(resmon_export_cb_t cb, void *arg)
+{
+    _export_cb = cb;
+    _export_arg = arg;
+}
+
+void resmon_export_stdio(const void *record, size_t len, void *arg)
+{
+    (void)arg;
+    stdio_write(record, len);
+}
+
+static uint8_t *_put_loads(uint8_t *pos, const uint32_t *load)
+{
+    for (unsigned i = 0; i < RESMON_WINDOW_NUMOF; i++) {
+        byteorder_htobebufs(pos, load[i] >> LOAD_SHIFT);
+        pos += 2;
+    }
+    return pos;
+}
+
+ssize_t resmon_get_record(void *buf, size_t len)
+{
+    uint8_t *pos = buf;
+    unsigned numof = 0;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        numof += _pid_reported(pid);
+    }
+    if (len < RESMON_RECORD_SIZE(numof)) {
+        return -ENOBUFS;
+    }
+
+    *pos++ = RESMON_RECORD_MAGIC;
+    *pos++ = RESMON_RECORD_VERSION;
+    byteorder_htobebufs(pos, _seq);
+    pos += 2;
+    byteorder_htobebufl(pos, _last_sample / US_PER_MS);
+    pos += 4;
+    *pos++ = numof;
+    *pos++ = RESMON_WINDOW_NUMOF;
+#if defined(DEVELHELP) && ISR_STACKSIZE
+    byteorder_htobebufs(pos, thread_isr_stack_usage());
+#else
+    byteorder_htobebufs(pos, 0);
+#endif
+    pos += 2;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (!_pid_reported(pid)) {
+            continue;
+        }
+        const thread_t *thread = thread_get(pid);
+        size_t size = thread ? thread_get_stacksize(thread) : 0;
+
+        *pos++ = pid;
+        pos = _put_loads(pos, _threads[pid].load);
+        byteorder_htobebufs(pos, size);
+        pos += 2;
+        byteorder_htobebufs(pos, resmon_stack_used(pid));
+        pos += 2;
+    }
+    return pos - (uint8_t *)buf;
+}
+
+unsigned resmon_load(kernel_pid_t pid, unsigned window)
+{
+    assert(window < RESMON_WINDOW_NUMOF);
+    if (!_pid_reported(pid)) {
+        return 0;
+    }
+    return _threads[pid].load[window] >> LOAD_SHIFT;
+}
+
+size_t resmon_stack_used(kernel_pid_t pid)
+{
+    const thread_t *thread = pid_is_valid(pid) ? thread_get(pid) : NULL;
+
+    if ((thread == NULL) || (_threads[pid].thread != thread) ||
+        (thread_get_stacksize(thread) == 0)) {
+        return 0;
+    }
+    return thread_get_stacksize(thread) -
+           _threads[pid].free_words * sizeof(uintptr_t);
+}
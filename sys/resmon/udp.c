@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_resmon
+ * @{
+ *
+ * @file
+ * @brief       Resource monitor export over UDP
+ *
+ * @}
+ */
+
+#include "net/sock/udp.h"
+#include "resmon.h"
+
+static sock_udp_t _sock;
+static sock_udp_ep_t _remote;
+
+static void _export_udp(const void *record, size_t len, void *arg)
+{
+    (void)arg;
+    /* records are sent periodically anyway, so a lost one is not retried */
+    sock_udp_send(&_sock, record, len, &_remote);
+}
+
+int resmon_udp_init(const sock_udp_ep_t *remote)
+{
+    int res = sock_udp_create(&_sock, NULL, NULL, 0);
+
+    if (res < 0) {
+        return res;
+    }
+    _remote = *remote;
+    resmon_set_export_cb(_export_udp, NULL);
+    return 0;
+}
@@ -148,6 +148,8 @@ static const char *_netstats_module_to_str(uint8_t module)
         return "Layer 2";
     case NETSTATS_IPV6:
         return "IPv6";
+    case NETSTATS_PKTQ:
+        return "packet queue";
     case NETSTATS_ALL:
         return "all";
     default:
@@ -187,6 +189,40 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
     }
     return res;
 }
+
+#if IS_USED(MODULE_NETSTATS_PKTQ) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+static int _netif_stats_pktq(netif_t *iface, bool reset)
+{
+    static const char *names[] = {
+        [GNRC_NETIF_PKTQ_CLASS_CTRL] = "control",
+        [GNRC_NETIF_PKTQ_CLASS_DATA] = "data",
+    };
+    netstats_pktq_t stats[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    int res = netif_get_opt(iface, NETOPT_STATS, NETSTATS_PKTQ, stats,
+                            sizeof(stats));
+
+    if (res < 0) {
+        printf("           Packet queue doesn't provide statistics.\n");
+    }
+    else if (reset) {
+        res = netif_set_opt(iface, NETOPT_STATS, NETSTATS_PKTQ, NULL, 0);
+        printf("Reset statistics for module %s: %s!\n",
+               _netstats_module_to_str(NETSTATS_PKTQ),
+               (res < 0) ? "failed" : "succeeded");
+    }
+    else {
+        printf("          Statistics for %s\n",
+               _netstats_module_to_str(NETSTATS_PKTQ));
+        for (unsigned i = 0; i < GNRC_NETIF_PKTQ_CLASS_NUMOF; i++) {
+            printf("            %-7s queued %u (max %u)  total %u  dropped %u\n",
+                   names[i], (unsigned)stats[i].len, (unsigned)stats[i].len_max,
+                   (unsigned)stats[i].enqueued, (unsigned)stats[i].dropped);
+        }
+        res = 0;
+    }
+    return res;
+}
+#endif
 #endif /* MODULE_NETSTATS */
 
 static void _link_usage(char *cmd_name)
@@ -291,7 +327,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|pktq] [reset]\n", cmd_name);
     printf("       reset can be only used if the module is specified.\n");
 }
 #endif
@@ -964,6 +1000,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_NETSTATS_PKTQ) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+    _netif_stats_pktq(iface, false);
 #endif
     puts("");
 }
@@ -1918,6 +1957,9 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+            else if (strcmp(argv[3], "pktq") == 0) {
+                module = NETSTATS_PKTQ;
+            }
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1934,6 +1976,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#if IS_USED(MODULE_NETSTATS_PKTQ) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+            if (module & NETSTATS_PKTQ) {
+                _netif_stats_pktq(iface, reset);
+            }
+#endif
 
             return 1;
         }
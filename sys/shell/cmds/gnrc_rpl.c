@@ -316,8 +316,14 @@ int _gnrc_rpl_dodag_show(void)
                ipv6_addr_to_str(addr_str, &dodag->dodag_id, sizeof(addr_str)),
                dodag->my_rank, (dodag->node_status == GNRC_RPL_LEAF_NODE ? "Leaf" : "Router"),
                ((dodag->dio_opts & GNRC_RPL_REQ_DIO_OPT_PREFIX_INFO) ? "on" : "off"),
-               (1 << dodag->dio_min), dodag->dio_interval_doubl, dodag->trickle.k,
-               dodag->trickle.c);
+               (1 << dodag->dio_min), dodag->dio_interval_doubl,
+               trickle_get_k(&dodag->trickle), dodag->trickle.c);
+#ifdef MODULE_TRICKLE_STATS
+        printf("\ttrickle [TX: %" PRIu32 " | suppressed: %" PRIu32 " | heard: %" PRIu32
+               " | resets: %" PRIu32 "]\n",
+               dodag->trickle.stats.tx, dodag->trickle.stats.suppressed,
+               dodag->trickle.stats.heard, dodag->trickle.stats.resets);
+#endif
 
 #ifdef MODULE_GNRC_RPL_P2P
         if (dodag->instance->mop == GNRC_RPL_P2P_MOP) {
@@ -449,9 +449,17 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
+#if CONFIG_SUIT_COAP_BLOCK_WINDOW > 1
+        static uint8_t window_buf[(CONFIG_SUIT_COAP_BLOCK_WINDOW - 1) <<
+                                  (CONFIG_SUIT_COAP_BLOCKSIZE + 4)];
+        res = nanocoap_get_blockwise_window_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
+                                                window_buf, sizeof(window_buf),
+                                                _storage_helper, manifest);
+#else
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
                                          _storage_helper,
                                          manifest);
+#endif
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
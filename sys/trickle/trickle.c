@@ -15,6 +15,8 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "inttypes.h"
 #include "random.h"
@@ -24,12 +26,60 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* lower bound of trickle_t::tx_avg, limits the neighbor estimation to four
+ * times the messages heard */
+#define TX_AVG_MIN  (64U)
+
+uint8_t trickle_get_k(const trickle_t *trickle)
+{
+#if IS_USED(MODULE_TRICKLE_ADAPTIVE)
+    /* assume every neighbor transmits in about the same share of intervals
+     * as we do */
+    uint32_t neighbors = (trickle->heard_avg * 16U) /
+                         ((trickle->tx_avg > TX_AVG_MIN) ? trickle->tx_avg
+                                                         : TX_AVG_MIN);
+
+    if ((trickle->k > 0) && (neighbors > CONFIG_TRICKLE_ADAPTIVE_DENSITY)) {
+        uint32_t k = (trickle->k * CONFIG_TRICKLE_ADAPTIVE_DENSITY) / neighbors;
+
+        return (k > 0) ? k : 1;
+    }
+#endif
+    return trickle->k;
+}
+
+static void _update_density(trickle_t *trickle, bool tx)
+{
+#if IS_USED(MODULE_TRICKLE_ADAPTIVE)
+    uint16_t c = (trickle->c < 0xfff) ? trickle->c : 0xfff;
+
+    /* moving averages with a weight of 1/4 for the last interval */
+    trickle->heard_avg = trickle->heard_avg - (trickle->heard_avg >> 2) + (c << 2);
+    trickle->tx_avg = trickle->tx_avg - (trickle->tx_avg >> 2) + ((tx) ? 64 : 0);
+#else
+    (void)trickle;
+    (void)tx;
+#endif
+}
+
 void trickle_callback(trickle_t *trickle)
 {
+    uint8_t k = trickle_get_k(trickle);
     /* Handle k=0 like k=infinity (according to RFC6206, section 6.5) */
-    if ((trickle->c < trickle->k) || (trickle->k == 0)) {
+    bool tx = (trickle->c < k) || (k == 0);
+
+    _update_density(trickle, tx);
+    if (tx) {
+#if IS_USED(MODULE_TRICKLE_STATS)
+        trickle->stats.tx++;
+#endif
         (*trickle->callback.func)(trickle->callback.args);
     }
+#if IS_USED(MODULE_TRICKLE_STATS)
+    else {
+        trickle->stats.suppressed++;
+    }
+#endif
 
     trickle_interval(trickle);
 }
@@ -62,6 +112,9 @@ void trickle_reset_timer(trickle_t *trickle)
 {
     assert(trickle->I > trickle->Imin);
 
+#if IS_USED(MODULE_TRICKLE_STATS)
+    trickle->stats.resets++;
+#endif
     trickle_stop(trickle);
     trickle->I = trickle->t = trickle->Imin;
     trickle_interval(trickle);
@@ -82,6 +135,14 @@ void trickle_start(kernel_pid_t pid, trickle_t *trickle, uint16_t msg_type,
     trickle->pid = pid;
     trickle->msg.content.ptr = trickle;
     trickle->msg.type = msg_type;
+#if IS_USED(MODULE_TRICKLE_ADAPTIVE)
+    /* start out assuming to be alone */
+    trickle->heard_avg = 0;
+    trickle->tx_avg = 256;
+#endif
+#if IS_USED(MODULE_TRICKLE_STATS)
+    memset(&trickle->stats, 0, sizeof(trickle->stats));
+#endif
 
     trickle_interval(trickle);
 }
@@ -93,5 +154,8 @@ void trickle_stop(trickle_t *trickle)
 
 void trickle_increment_counter(trickle_t *trickle)
 {
+#if IS_USED(MODULE_TRICKLE_STATS)
+    trickle->stats.heard++;
+#endif
     trickle->c++;
 }
@@ -156,7 +156,54 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+/* Returns the offset to fire a timer at that may fire anywhere within
+ * [val, val + slack]. Must be called with interrupts disabled and the head
+ * offset updated. */
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t slack)
+{
+    uint32_t target = 0;
+
+    /* join the earliest timer already set within the window, so both fire
+     * with a single interrupt */
+    for (const ztimer_base_t *entry = clock->list.next; entry;
+         entry = entry->next) {
+        if (entry->offset > UINT32_MAX - target) {
+            /* no timer left that fits into a 32 bit offset */
+            break;
+        }
+        target += entry->offset;
+        if (target >= val) {
+            if ((target - val) <= slack) {
+                DEBUG("ztimer_set_with_slack(): %p: joining %p at %" PRIu32
+                      "\n", (void *)clock, (void *)entry, target);
+                return target;
+            }
+            break;
+        }
+    }
+
+    /* otherwise, round the absolute target up to the coarsest power of two
+     * within the slack, so that timers set independently of each other end
+     * up on the same ticks */
+    uint32_t granularity = slack;
+    while (granularity & (granularity - 1)) {
+        /* clear the lowest set bit until only the highest one is left */
+        granularity &= granularity - 1;
+    }
+    uint32_t abs_target = clock->list.offset + val;
+    uint32_t aligned = (abs_target + granularity - 1) & ~(granularity - 1);
+
+    uint32_t delay = aligned - abs_target;
+
+    if ((delay <= slack) && (delay <= UINT32_MAX - val)) {
+        return val + delay;
+    }
+    return val;
+}
+
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -191,6 +238,10 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+    if (slack) {
+        val = _coalesce(clock, val, slack);
+    }
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     _ztimer_update(clock);
@@ -213,6 +264,17 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    return _ztimer_set(clock, timer, val, 0);
+}
+
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack)
+{
+    return _ztimer_set(clock, timer, val, slack);
+}
+
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the lock-free SPSC and MPSC queues with mbox
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mbox.h"
+#include "mpsc_queue.h"
+#include "msg.h"
+#include "spsc_queue.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef TEST_ITERATIONS
+#define TEST_ITERATIONS     (100000U)
+#endif
+
+#define QUEUE_SIZE          (16U)
+#define FLAG_DONE           (0x1)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_main;
+
+static msg_t _mbox_queue[QUEUE_SIZE];
+static mbox_t _mbox;
+
+static msg_t _spsc_buf[QUEUE_SIZE];
+static spsc_queue_t _spsc;
+
+static uint8_t _mpsc_buf[MPSC_QUEUE_BUF_SIZE(sizeof(msg_t), QUEUE_SIZE)];
+static mpsc_queue_t _mpsc;
+
+static void *_mbox_consumer(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        mbox_get(&_mbox, &msg);
+    }
+    thread_flags_set(_main, FLAG_DONE);
+    return NULL;
+}
+
+static void *_spsc_consumer(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        spsc_queue_get_blocking(&_spsc, &msg);
+    }
+    thread_flags_set(_main, FLAG_DONE);
+    return NULL;
+}
+
+static void *_mpsc_consumer(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        mpsc_queue_get_blocking(&_mpsc, &msg);
+    }
+    thread_flags_set(_main, FLAG_DONE);
+    return NULL;
+}
+
+static void _mbox_producer(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        msg.content.value = i;
+        mbox_put(&_mbox, &msg);
+    }
+}
+
+static void _spsc_producer(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        msg.content.value = i;
+        spsc_queue_put_blocking(&_spsc, &msg);
+    }
+}
+
+static void _mpsc_producer(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        msg.content.value = i;
+        mpsc_queue_put_blocking(&_mpsc, &msg);
+    }
+}
+
+static void _mbox_roundtrip(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        mbox_try_put(&_mbox, &msg);
+        mbox_try_get(&_mbox, &msg);
+    }
+}
+
+static void _spsc_roundtrip(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        spsc_queue_put(&_spsc, &msg);
+        spsc_queue_get(&_spsc, &msg);
+    }
+}
+
+static void _mpsc_roundtrip(void)
+{
+    msg_t msg = { .type = 0 };
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        mpsc_queue_put(&_mpsc, &msg);
+        mpsc_queue_get(&_mpsc, &msg);
+    }
+}
+
+static void _run(const char *name, thread_task_func_t consumer,
+                 void (*producer)(void))
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    if (consumer != NULL) {
+        /* lower priority than main, so the producer fills the queue before
+         * the consumer gets to run */
+        thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                      consumer, NULL, "consumer");
+    }
+    producer();
+    if (consumer != NULL) {
+        thread_flags_wait_any(FLAG_DONE);
+    }
+    printf("{ \"name\" : \"%s\", \"us\" : %" PRIu32 " }\n",
+           name, ztimer_now(ZTIMER_USEC) - start);
+    /* let the consumer terminate before its stack is reused */
+    thread_yield_higher();
+    ztimer_sleep(ZTIMER_USEC, 1000);
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    mbox_init(&_mbox, _mbox_queue, QUEUE_SIZE);
+    spsc_queue_init(&_spsc, _spsc_buf, sizeof(_spsc_buf[0]), QUEUE_SIZE);
+    mpsc_queue_init(&_mpsc, _mpsc_buf, sizeof(msg_t), QUEUE_SIZE);
+
+    printf("main starting, %u iterations\n", TEST_ITERATIONS);
+
+    _run("mbox roundtrip", NULL, _mbox_roundtrip);
+    _run("spsc roundtrip", NULL, _spsc_roundtrip);
+    _run("mpsc roundtrip", NULL, _mpsc_roundtrip);
+    _run("mbox threads", _mbox_consumer, _mbox_producer);
+    _run("spsc threads", _spsc_consumer, _spsc_producer);
+    _run("mpsc threads", _mpsc_consumer, _mpsc_producer);
+
+    puts("done");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for queue in ("mbox", "spsc", "mpsc"):
+        child.expect(r"{ \"name\" : \"%s roundtrip\", \"us\" : \d+ }" % queue)
+    for queue in ("mbox", "spsc", "mpsc"):
+        child.expect(r"{ \"name\" : \"%s threads\", \"us\" : \d+ }" % queue)
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,434 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures CoAP request throughput and latency of gcoap
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "net/sock/udp.h"
+#include "random.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_GCOAP_DTLS)
+#include "net/credman.h"
+#include "net/sock/dtls.h"
+#endif
+
+#ifndef BENCH_SERVER
+#define BENCH_SERVER            "::1"
+#endif
+
+#ifndef BENCH_CLIENTS
+#define BENCH_CLIENTS           (1U)
+#endif
+
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS       (1000U)
+#endif
+
+#ifndef BENCH_OBSERVERS
+#define BENCH_OBSERVERS         CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
+#endif
+
+/* latency samples kept per client for the percentiles */
+#ifndef BENCH_SAMPLES_MAX
+#define BENCH_SAMPLES_MAX       (2048U)
+#endif
+
+#define BENCH_PAYLOAD_MAX       (512U)
+#define BENCH_OBS_PORT          (6000U)
+#define BENCH_OBS_TIMEOUT_US    (100U * US_PER_MS)
+#define BENCH_DTLS_TAG          CONFIG_NANOCOAP_SOCK_DTLS_TAG
+
+#if IS_USED(MODULE_GCOAP_DTLS)
+#define BENCH_PORT              CONFIG_GCOAPS_PORT
+#define BENCH_STACKSIZE         (4 * THREAD_STACKSIZE_LARGE)
+#else
+#define BENCH_PORT              CONFIG_GCOAP_PORT
+#define BENCH_STACKSIZE         THREAD_STACKSIZE_LARGE
+#endif
+
+#define FLAG_RESP               (0x1)
+
+static_assert(BENCH_CLIENTS <= 8, "client threads are joined with thread flags");
+
+typedef struct {
+    uint32_t samples[BENCH_SAMPLES_MAX];
+    unsigned requests;
+    unsigned errors;
+} _stats_t;
+
+static const uint16_t _sizes[] = { 16, 128, BENCH_PAYLOAD_MAX };
+
+static uint8_t _payload[BENCH_PAYLOAD_MAX];
+static sock_udp_ep_t _remote;
+static thread_t *_main;
+
+/* parameters of the current run */
+static unsigned _method;
+static char _path[16];
+static size_t _len;
+static uint32_t _deadline;
+
+static _stats_t _stats[BENCH_CLIENTS];
+static uint32_t _sorted[BENCH_CLIENTS * BENCH_SAMPLES_MAX];
+static char _stacks[BENCH_CLIENTS][BENCH_STACKSIZE];
+static uint8_t _resp[BENCH_CLIENTS][BENCH_PAYLOAD_MAX + 64];
+
+#if IS_USED(MODULE_GCOAP_DTLS)
+static const char _psk_id[] = "Client_identity";
+static const char _psk_key[] = "secretPSK";
+static const credman_credential_t _credential = {
+    .type = CREDMAN_TYPE_PSK,
+    .tag = BENCH_DTLS_TAG,
+    .params = {
+        .psk = {
+            .key = { .s = _psk_key, .len = sizeof(_psk_key) - 1, },
+            .id = { .s = _psk_id, .len = sizeof(_psk_id) - 1, },
+        }
+    },
+};
+#endif
+
+static ssize_t _bench_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    char path[CONFIG_NANOCOAP_URI_MAX];
+
+    if (coap_get_code_detail(pdu) == COAP_METHOD_PUT) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_CHANGED);
+    }
+
+    /* the payload size is the last path segment, as in /bench/128 */
+    if (coap_get_uri_path(pdu, (uint8_t *)path) <= (ssize_t)sizeof("/bench/")) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_BAD_REQUEST);
+    }
+    size_t size = strtoul(path + sizeof("/bench/") - 1, NULL, 10);
+    if (size > sizeof(_payload)) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_BAD_REQUEST);
+    }
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_OCTET);
+    ssize_t hdr_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    if (pdu->payload_len < size) {
+        return -ENOBUFS;
+    }
+    memcpy(pdu->payload, _payload, size);
+    return hdr_len + size;
+}
+
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+/* must be sorted by path */
+static const coap_resource_t _resources[] = {
+    { "/bench", COAP_GET | COAP_PUT | COAP_MATCH_SUBTREE, _bench_handler, NULL },
+    { "/obs", COAP_GET, _obs_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static void _record(_stats_t *stats, uint32_t us)
+{
+    /* reservoir sampling, so the kept samples represent the whole run */
+    unsigned pos = stats->requests++;
+
+    if (pos >= BENCH_SAMPLES_MAX) {
+        pos = random_uint32_range(0, pos + 1);
+    }
+    if (pos < BENCH_SAMPLES_MAX) {
+        stats->samples[pos] = us;
+    }
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void _start(void)
+{
+    memset(_stats, 0, sizeof(_stats));
+    _deadline = ztimer_now(ZTIMER_USEC) + BENCH_DURATION_MS * US_PER_MS;
+}
+
+static void _report(const char *name, size_t size, uint32_t us)
+{
+    unsigned requests = 0;
+    unsigned errors = 0;
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < BENCH_CLIENTS; i++) {
+        unsigned kept = _stats[i].requests < BENCH_SAMPLES_MAX
+                      ? _stats[i].requests : BENCH_SAMPLES_MAX;
+        memcpy(&_sorted[numof], _stats[i].samples, kept * sizeof(_sorted[0]));
+        numof += kept;
+        requests += _stats[i].requests;
+        errors += _stats[i].errors;
+    }
+    qsort(_sorted, numof, sizeof(_sorted[0]), _cmp);
+
+    printf("{ \"name\" : \"%s %u\", \"requests\" : %u, \"errors\" : %u, "
+           "\"rps\" : %" PRIu32 ", \"p50_us\" : %" PRIu32 ", \"p99_us\" : %" PRIu32 " }\n",
+           name, (unsigned)size, requests, errors,
+           (uint32_t)(((uint64_t)requests * US_PER_SEC) / us),
+           numof ? _sorted[numof / 2] : 0,
+           numof ? _sorted[(numof * 99) / 100] : 0);
+}
+
+static bool _running(void)
+{
+    return (int32_t)(ztimer_now(ZTIMER_USEC) - _deadline) < 0;
+}
+
+static int _connect(nanocoap_sock_t *sock)
+{
+#if IS_USED(MODULE_GCOAP_DTLS)
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    return nanocoap_sock_dtls_connect(sock, &local, &_remote, BENCH_DTLS_TAG);
+#else
+    return nanocoap_sock_connect(sock, NULL, &_remote);
+#endif
+}
+
+static void *_client(void *arg)
+{
+    _stats_t *stats = &_stats[(uintptr_t)arg];
+    uint8_t *resp = _resp[(uintptr_t)arg];
+    nanocoap_sock_t sock;
+
+    int res = _connect(&sock);
+    if (res < 0) {
+        printf("client: can't connect: %d\n", res);
+        stats->errors++;
+    }
+    else {
+        while (_running()) {
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            if (_method == COAP_METHOD_PUT) {
+                res = nanocoap_sock_put(&sock, _path, _payload, _len, resp,
+                                        sizeof(_resp[0]));
+            }
+            else {
+                res = nanocoap_sock_get(&sock, _path, resp, sizeof(_resp[0]));
+            }
+            if (res < 0) {
+                stats->errors++;
+                continue;
+            }
+            _record(stats, ztimer_now(ZTIMER_USEC) - start);
+        }
+        nanocoap_sock_close(&sock);
+    }
+    thread_flags_set(_main, 1 << (uintptr_t)arg);
+    return NULL;
+}
+
+static void _run_clients(const char *name, unsigned method, size_t size)
+{
+    _method = method;
+    _len = size;
+    if (method == COAP_METHOD_PUT) {
+        strcpy(_path, "/bench");
+    }
+    else {
+        snprintf(_path, sizeof(_path), "/bench/%u", (unsigned)size);
+    }
+
+    _start();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uintptr_t i = 0; i < BENCH_CLIENTS; i++) {
+        /* lower priority than main, so all clients are started at once */
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      0, _client, (void *)i, "client");
+    }
+    thread_flags_wait_all((1 << BENCH_CLIENTS) - 1);
+    _report(name, size, ztimer_now(ZTIMER_USEC) - start);
+    /* let the clients terminate before their stacks are reused */
+    ztimer_sleep(ZTIMER_USEC, 1000);
+}
+
+static void _gcoap_resp_handler(const gcoap_request_memo_t *memo,
+                                coap_pkt_t *pdu, const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+    (void)remote;
+    if (memo->state != GCOAP_MEMO_RESP) {
+        _stats[0].errors++;
+    }
+    thread_flags_set(_main, FLAG_RESP);
+}
+
+/* GETs through the gcoap client, served from nanocoap_cache if enabled */
+static void _run_gcoap_client(size_t size)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    snprintf(_path, sizeof(_path), "/bench/%u", (unsigned)size);
+
+    _start();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (_running()) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, _path);
+        ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+        unsigned errors = _stats[0].errors;
+        if (gcoap_req_send(buf, len, &_remote, NULL, _gcoap_resp_handler, NULL,
+                           GCOAP_SOCKET_TYPE_UDP) <= 0) {
+            _stats[0].errors++;
+            continue;
+        }
+        thread_flags_wait_any(FLAG_RESP);
+        if (_stats[0].errors == errors) {
+            _record(&_stats[0], ztimer_now(ZTIMER_USEC) - now);
+        }
+    }
+    _report(IS_USED(MODULE_NANOCOAP_CACHE) ? "gcoap GET cached" : "gcoap GET",
+            size, ztimer_now(ZTIMER_USEC) - start);
+}
+
+static int _register_observer(sock_udp_t *sock, uint16_t port)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    uint8_t buf[32];
+    uint8_t token = port;
+    coap_pkt_t pdu;
+
+    local.port = port;
+    int res = sock_udp_create(sock, &local, NULL, 0);
+    if (res < 0) {
+        return res;
+    }
+
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_NON, &token,
+                                     sizeof(token), COAP_METHOD_GET, port);
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    coap_opt_add_string(&pdu, COAP_OPT_URI_PATH, "/obs", '/');
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    res = sock_udp_send(sock, buf, len, &_remote);
+    if (res < 0) {
+        return res;
+    }
+    /* wait for the response confirming the registration */
+    return sock_udp_recv(sock, buf, sizeof(buf), BENCH_OBS_TIMEOUT_US, NULL);
+}
+
+/* notifications fanned out to BENCH_OBSERVERS observers */
+static void _run_observe(sock_udp_t *observers, size_t size)
+{
+    _start();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (_running()) {
+        uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+        coap_pkt_t pdu;
+
+        if (gcoap_obs_init(&pdu, buf, sizeof(buf), &_resources[1]) != GCOAP_OBS_INIT_OK) {
+            _stats[0].errors++;
+            break;
+        }
+        ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+        memcpy(pdu.payload, _payload, size);
+        uint32_t sent = ztimer_now(ZTIMER_USEC);
+        gcoap_obs_send(buf, len + size, &_resources[1]);
+
+        for (unsigned i = 0; i < BENCH_OBSERVERS; i++) {
+            if (sock_udp_recv(&observers[i], _resp[0], sizeof(_resp[0]),
+                              BENCH_OBS_TIMEOUT_US, NULL) <= 0) {
+                _stats[0].errors++;
+                continue;
+            }
+            _record(&_stats[0], ztimer_now(ZTIMER_USEC) - sent);
+        }
+    }
+    _report("Observe", size, ztimer_now(ZTIMER_USEC) - start);
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    for (unsigned i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i;
+    }
+
+#if IS_USED(MODULE_GCOAP_DTLS)
+    credman_add(&_credential);
+    sock_dtls_add_credential(gcoap_get_sock_dtls(), BENCH_DTLS_TAG);
+#endif
+    gcoap_register_listener(&_listener);
+
+    _remote = (sock_udp_ep_t){ .family = AF_INET6, .port = BENCH_PORT };
+    if (ipv6_addr_from_str((ipv6_addr_t *)_remote.addr.ipv6, BENCH_SERVER) == NULL) {
+        puts("invalid BENCH_SERVER");
+        return 1;
+    }
+    if (ipv6_addr_is_link_local((ipv6_addr_t *)_remote.addr.ipv6)) {
+        netif_t *netif = netif_iter(NULL);
+        _remote.netif = netif ? netif_get_id(netif) : 0;
+    }
+    /* give the network interfaces some time to come up */
+    ztimer_sleep(ZTIMER_MSEC, 1000);
+
+    printf("main starting, server %s, %u clients, %u ms per run\n",
+           BENCH_SERVER, BENCH_CLIENTS, BENCH_DURATION_MS);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _run_clients("GET", COAP_METHOD_GET, _sizes[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _run_clients("PUT", COAP_METHOD_PUT, _sizes[i]);
+    }
+
+    /* the gcoap client would talk DTLS to its own socket, and notifications
+     * are only triggered for the local server */
+    if (!IS_USED(MODULE_GCOAP_DTLS) &&
+        ipv6_addr_is_loopback((ipv6_addr_t *)_remote.addr.ipv6)) {
+        static sock_udp_t observers[BENCH_OBSERVERS];
+
+        for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+            _run_gcoap_client(_sizes[i]);
+        }
+        for (unsigned i = 0; i < BENCH_OBSERVERS; i++) {
+            if (_register_observer(&observers[i], BENCH_OBS_PORT + i) <= 0) {
+                printf("observer %u: registration failed\n", i);
+            }
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+            _run_observe(observers, _sizes[i]);
+        }
+    }
+
+    puts("done");
+    return 0;
+}
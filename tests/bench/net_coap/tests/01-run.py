@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+SIZES = (16, 128, 512)
+RESULT = (r"{ \"name\" : \"%s %d\", \"requests\" : \d+, \"errors\" : \d+, "
+          r"\"rps\" : \d+, \"p50_us\" : \d+, \"p99_us\" : \d+ }")
+
+
+def testfunc(child):
+    for method in ("GET", "PUT"):
+        for size in SIZES:
+            child.expect(RESULT % (method, size))
+    for name in ("gcoap GET( cached)?", "Observe"):
+        for size in SIZES:
+            child.expect(RESULT % (name, size))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
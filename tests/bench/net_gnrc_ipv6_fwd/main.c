@@ -0,0 +1,250 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the forwarding rate of GNRC's IPv6 layer
+ *
+ * @}
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_PKTS
+#define BENCH_PKTS              (8192U)
+#endif
+
+#ifndef BENCH_FLOWS
+#define BENCH_FLOWS             (8U)
+#endif
+
+#ifndef BENCH_BURST
+#define BENCH_BURST             (8U)
+#endif
+
+#ifndef BENCH_WORKERS
+#define BENCH_WORKERS           (0U)
+#endif
+
+#ifndef BENCH_CACHE
+#define BENCH_CACHE             (0U)
+#endif
+
+/* packets of a burst not forwarded by then are counted as failed */
+#ifndef BENCH_TIMEOUT_MS
+#define BENCH_TIMEOUT_MS        (1000U)
+#endif
+
+#define NBR_MAC                 { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, }
+#define NBR_LINK_LOCAL          { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                                  0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST                     { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                                  0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST_PFX_LEN             (64U)
+/* IPv6 header + payload:         version+TC  FL: 0       plen: 16    NH:17 HL:64 */
+#define L2_PAYLOAD              { 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x40, \
+                                  /* source: last byte is the flow */             \
+                                  0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01, \
+                                  0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x00, \
+                                  /* destination: DST */                          \
+                                  0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                                  0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, \
+                                  /* random payload of length 16 */               \
+                                  0x54, 0xb8, 0x59, 0xaf, 0x3a, 0xb4, 0x5c, 0x85, \
+                                  0x1e, 0xce, 0xe2, 0xeb, 0x05, 0x4e, 0xa3, 0x85, }
+#define L2_PAYLOAD_FLOW_POS     (23U)
+
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _dst = { .u8 = DST };
+static uint8_t _l2_payload[] = L2_PAYLOAD;
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _burst_done = MUTEX_INIT_LOCKED;
+/* both only accessed with interrupts disabled */
+static unsigned _forwarded;
+static unsigned _expected = UINT_MAX;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+/* called from the thread of the interface for every frame it sends */
+static int _count_frame(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+
+    (void)dev;
+    /* the router sends e.g. advertisements of its own, too */
+    if (memcmp(hdr->dst, _nbr_mac, sizeof(_nbr_mac)) != 0) {
+        return iolist_size(iolist);
+    }
+
+    unsigned state = irq_disable();
+
+    if (++_forwarded == _expected) {
+        _expected = UINT_MAX;
+        mutex_unlock(&_burst_done);
+    }
+    irq_restore(state);
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _count_frame);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "bench_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    gnrc_ipv6_nib_init();
+    gnrc_ipv6_nib_init_iface(&_netif);
+    gnrc_ipv6_nib_iface_up(&_netif);
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif.pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbr_link_local,
+                                _netif.pid, 0) == 0);
+}
+
+/* waits until the netif thread sent num frames since base, returns the
+ * number of frames missing at timeout */
+static unsigned _wait_burst(unsigned base, unsigned num)
+{
+    unsigned state = irq_disable();
+    unsigned missing = 0;
+
+    if ((_forwarded - base) >= num) {
+        irq_restore(state);
+        return 0;
+    }
+    _expected = base + num;
+    irq_restore(state);
+
+    if (ztimer_mutex_lock_timeout(ZTIMER_MSEC, &_burst_done,
+                                  BENCH_TIMEOUT_MS) < 0) {
+        /* packets may have been dropped, e.g. by a full worker queue */
+        state = irq_disable();
+        _expected = UINT_MAX;
+        if ((_forwarded - base) < num) {
+            missing = num - (_forwarded - base);
+        }
+        irq_restore(state);
+        /* the last frame may have come in after the timeout */
+        mutex_trylock(&_burst_done);
+    }
+    return missing;
+}
+
+/* hands a packet to IPv6 the same way gnrc_netif does for received frames */
+static int _receive(unsigned flow)
+{
+    gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    gnrc_pktsnip_t *pkt;
+
+    if (netif_hdr == NULL) {
+        return -ENOMEM;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    _l2_payload[L2_PAYLOAD_FLOW_POS] = flow;
+    pkt = gnrc_pktbuf_add(netif_hdr, _l2_payload, sizeof(_l2_payload),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif_hdr);
+        return -ENOMEM;
+    }
+    if (gnrc_ipv6_fwd_workers_dispatch(pkt)) {
+        return 0;
+    }
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOENT;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    unsigned failed = 0;
+
+    _init_netif();
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned sent = 0; sent < BENCH_PKTS; sent += BENCH_BURST) {
+        unsigned state = irq_disable();
+        unsigned base = _forwarded;
+        unsigned burst = 0;
+
+        irq_restore(state);
+        for (unsigned i = 0; i < BENCH_BURST; i++) {
+            if (_receive((sent + i) % BENCH_FLOWS) < 0) {
+                failed++;
+            }
+            else {
+                burst++;
+            }
+        }
+        /* wait for the last packet of a burst before handing the next one */
+        failed += _wait_burst(base, burst);
+    }
+
+    uint32_t ms = ztimer_now(ZTIMER_MSEC) - start;
+    uint32_t pkt_s = ms ? (uint32_t)(((uint64_t)BENCH_PKTS * 1000) / ms) : 0;
+
+    printf("{ \"name\" : \"fwd %u workers%s\", \"pkts\" : %u, \"flows\" : %u, "
+           "\"failed\" : %u, \"ms\" : %" PRIu32 ", \"pkt_s\" : %" PRIu32 " }\n",
+           BENCH_WORKERS, BENCH_CACHE ? " cached" : "", BENCH_PKTS, BENCH_FLOWS,
+           failed, ms, pkt_s);
+    puts("done");
+    return 0;
+}
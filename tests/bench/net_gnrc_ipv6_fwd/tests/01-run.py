@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+RESULT = (r"{ \"name\" : \"fwd \d+ workers( cached)?\", \"pkts\" : \d+, "
+          r"\"flows\" : \d+, \"failed\" : 0, \"ms\" : \d+, \"pkt_s\" : \d+ }")
+
+
+def testfunc(child):
+    child.expect(RESULT)
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the transmit throughput of a GNRC network interface
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/gnrc/udp.h"
+#include "ztimer.h"
+
+#ifndef BENCH_FRAMES
+#define BENCH_FRAMES            (4096U)
+#endif
+
+#ifndef BENCH_PAYLOAD
+#define BENCH_PAYLOAD           (1024U)
+#endif
+
+#ifndef BENCH_BURST
+#define BENCH_BURST             (16U)
+#endif
+
+#define BENCH_PORT              (5003U)
+
+static int _send(gnrc_netif_t *netif, gnrc_tx_sync_t *sync)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, BENCH_PAYLOAD, GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+
+    if (pkt == NULL) {
+        return -ENOMEM;
+    }
+    if ((hdr = gnrc_udp_hdr_build(pkt, BENCH_PORT, BENCH_PORT)) == NULL) {
+        goto fail;
+    }
+    pkt = hdr;
+    if ((hdr = gnrc_ipv6_hdr_build(pkt, NULL, &ipv6_addr_all_nodes_link_local)) == NULL) {
+        goto fail;
+    }
+    pkt = hdr;
+    if ((hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0)) == NULL) {
+        goto fail;
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, netif);
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    if ((sync != NULL) && (gnrc_tx_sync_append(pkt, sync) < 0)) {
+        goto fail;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        goto fail;
+    }
+    return 0;
+
+fail:
+    gnrc_pktbuf_release(pkt);
+    return -ENOMEM;
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    uint8_t tx_queue_len = 1;
+
+    if (netif == NULL) {
+        puts("no network interface");
+        return 1;
+    }
+    gnrc_netapi_get(netif->pid, NETOPT_TX_QUEUE_LEN, 0, &tx_queue_len,
+                    sizeof(tx_queue_len));
+
+    /* only the frames of this run */
+    uint32_t tx_bytes = netif->stats.tx_bytes;
+    unsigned failed = 0;
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned sent = 0; sent < BENCH_FRAMES; sent += BENCH_BURST) {
+        gnrc_tx_sync_t sync = gnrc_tx_sync_init();
+        int res = 0;
+
+        /* wait for the last frame of a burst before sending the next burst */
+        for (unsigned i = 0; i < BENCH_BURST; i++) {
+            res = _send(netif, (i == BENCH_BURST - 1) ? &sync : NULL);
+            if (res < 0) {
+                failed++;
+            }
+        }
+        if (res == 0) {
+            gnrc_tx_sync(&sync);
+        }
+    }
+
+    uint32_t ms = ztimer_now(ZTIMER_MSEC) - start;
+    uint32_t bytes = netif->stats.tx_bytes - tx_bytes;
+    /* kbit/s = bytes * 8 / ms */
+    uint32_t kbit_s = ms ? (uint32_t)(((uint64_t)bytes * 8) / ms) : 0;
+
+    printf("{ \"name\" : \"tx %u\", \"frames\" : %u, \"failed\" : %u, \"bytes\" : %"
+           PRIu32 ", \"ms\" : %" PRIu32 ", \"kbit_s\" : %" PRIu32 " }\n",
+           tx_queue_len, BENCH_FRAMES, failed, bytes, ms, kbit_s);
+    puts("done");
+    return 0;
+}
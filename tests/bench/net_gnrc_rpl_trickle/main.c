@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Node of the RPL control plane overhead simulation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/rpl.h"
+#include "shell.h"
+#include "trickle.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static const ipv6_addr_t _dodag_id = {{ 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                                        0, 0, 0, 0, 0, 0, 0, 0x01 }};
+
+static uint32_t _block_sum(const netstats_rpl_block_t *block, bool bytes)
+{
+    return (bytes) ? (block->tx_ucast_bytes + block->tx_mcast_bytes)
+                   : (block->tx_ucast_count + block->tx_mcast_count);
+}
+
+static uint32_t _ctrl_sum(bool bytes)
+{
+    return _block_sum(&gnrc_rpl_netstats.dio, bytes) +
+           _block_sum(&gnrc_rpl_netstats.dis, bytes) +
+           _block_sum(&gnrc_rpl_netstats.dao, bytes) +
+           _block_sum(&gnrc_rpl_netstats.dao_ack, bytes);
+}
+
+static int _root(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+
+    if ((gnrc_netif_ipv6_addr_add(netif, &_dodag_id, 64,
+                                  GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) ||
+        (gnrc_ipv6_nib_pl_set(netif->pid, &_dodag_id, 64,
+                              UINT32_MAX, UINT32_MAX) < 0)) {
+        puts("error: can't configure prefix");
+        return 1;
+    }
+    gnrc_rpl_configure_root(netif, &_dodag_id);
+    puts("root");
+    return 0;
+}
+
+static int _stats(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    gnrc_rpl_instance_t *inst = gnrc_rpl_instance_get(CONFIG_GNRC_RPL_DEFAULT_INSTANCE);
+    trickle_t *trickle = (inst) ? &inst->dodag.trickle : NULL;
+
+    printf("{ \"rank\" : %u, \"k\" : %u, \"tx\" : %" PRIu32 ", "
+           "\"suppressed\" : %" PRIu32 ", \"heard\" : %" PRIu32 ", "
+           "\"resets\" : %" PRIu32 ", \"ctrl_pkts\" : %" PRIu32 ", "
+           "\"ctrl_bytes\" : %" PRIu32 " }\n",
+           (inst) ? inst->dodag.my_rank : GNRC_RPL_INFINITE_RANK,
+           (trickle) ? trickle_get_k(trickle) : 0,
+           (trickle) ? trickle->stats.tx : 0,
+           (trickle) ? trickle->stats.suppressed : 0,
+           (trickle) ? trickle->stats.heard : 0,
+           (trickle) ? trickle->stats.resets : 0,
+           _ctrl_sum(false), _ctrl_sum(true));
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "root", "make this node the RPL root", _root },
+    { "stats", "print trickle and RPL statistics as JSON", _stats },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
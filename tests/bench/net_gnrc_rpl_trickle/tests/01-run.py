@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import time
+
+from subprocess import Popen
+from riotctrl.ctrl import RIOTCtrlBoardFactory
+from riotctrl.shell import ShellInteraction
+from riotctrl_ctrl import native
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(os.path.join(os.path.dirname(__file__), "../../../..")))
+ZEP_DISPATCH_PATH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+# set by the Makefile, which passes it to the nodes via TERMFLAGS
+ZEP_PORT = os.environ["ZEP_PORT"]
+
+NODES = int(os.getenv("BENCH_NODES", "16"))
+WINDOW = int(os.getenv("BENCH_WINDOW", "30"))
+ADAPTIVE = os.getenv("TRICKLE_ADAPTIVE", "1") != "0"
+CONVERGE_TIMEOUT = 60
+STATS_REGEX = re.compile(r"\{ \"rank\".*\}")
+
+
+class RIOTCtrlAppFactory(RIOTCtrlBoardFactory):
+
+    def __init__(self, board='native'):
+        super().__init__(board_cls={
+            board: native.NativeRIOTCtrl,
+        })
+        self.board = board
+        self.ctrl_list = list()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        for ctrl in self.ctrl_list:
+            ctrl.stop_term()
+
+    def get_shell(self, application_directory='.', env=None):
+        if env is None:
+            env = {'BOARD': self.board, 'ZEP_PORT': ZEP_PORT}
+        # retrieve a RIOTCtrl Object
+        ctrl = super().get_ctrl(
+            env=env,
+            application_directory=application_directory
+        )
+        # append ctrl to list
+        self.ctrl_list.append(ctrl)
+        # start terminal
+        ctrl.start_term()
+        # return ctrl with started terminal
+        return Shell(ctrl)
+
+    def get_shells(self, num=1):
+        terms = []
+        for i in range(num):
+            terms.append(self.get_shell())
+        return terms
+
+
+class Shell(ShellInteraction):
+
+    def stats(self):
+        return json.loads(STATS_REGEX.search(self.cmd("stats")).group(0))
+
+    def root(self):
+        assert "root" in self.cmd("root")
+
+
+def grid_topology(num):
+    """Grid of `num` nodes where every node is linked to its up to 8
+    surrounding nodes"""
+    width = math.ceil(math.sqrt(num))
+    edges = []
+    for i in range(num):
+        x, y = i % width, i // width
+        for dx, dy in ((1, 0), (-1, 1), (0, 1), (1, 1)):
+            j = (y + dy) * width + x + dx
+            if 0 <= x + dx < width and j < num:
+                edges.append("n{} n{}".format(i, j))
+    return "\n".join(edges) + "\n"
+
+
+def total(nodes_stats, key):
+    return sum(s[key] for s in nodes_stats)
+
+
+def test_grid_overhead(factory, zep_dispatch):
+    zep_dispatch.stdin.write(grid_topology(NODES).encode())
+    zep_dispatch.stdin.close()
+
+    # nodes are named in the order they connect, so n0 becomes root
+    nodes = factory.get_shells(NODES)
+    time.sleep(1)
+    nodes[0].root()
+
+    start = time.monotonic()
+    while any(n.stats()["rank"] == 0xffff for n in nodes):
+        assert (time.monotonic() - start) < CONVERGE_TIMEOUT, "DODAG did not converge"
+        time.sleep(0.5)
+    converged_ms = int((time.monotonic() - start) * 1000)
+    before = [n.stats() for n in nodes]
+    time.sleep(WINDOW)
+    after = [n.stats() for n in nodes]
+
+    result = {"name": "trickle{}".format(" adaptive" if ADAPTIVE else ""),
+              "nodes": NODES, "converged_ms": converged_ms, "window_s": WINDOW}
+    for key in ("ctrl_pkts", "ctrl_bytes", "tx", "suppressed", "resets"):
+        result[key] = total(after, key) - total(before, key)
+    result["k_min"] = min(s["k"] for s in after)
+    print(json.dumps(result))
+    assert result["ctrl_pkts"] > 0
+
+    # terminate nodes
+    for n in nodes:
+        n.stop_term()
+
+
+def run_test(func, factory):
+    with Popen([ZEP_DISPATCH_PATH, '-t', '-', '127.0.0.1', ZEP_PORT],
+               stdin=subprocess.PIPE, stdout=subprocess.DEVNULL) as zep_dispatch:
+        try:
+            func(factory, zep_dispatch)
+        finally:
+            zep_dispatch.terminate()
+
+
+if __name__ == "__main__":
+    board = os.environ.get('BOARD', 'native')
+    if board not in ['native', 'native32', 'native64']:
+        print('\x1b[1;31mThis test requires a native board.\x1b[0m\n',
+              file=sys.stderr)
+        sys.exit(1)
+
+    with RIOTCtrlAppFactory(board) as factory:
+        run_test(test_grid_overhead, factory)
+    print("done")
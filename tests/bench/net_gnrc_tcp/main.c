@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the bulk transfer throughput of GNRC TCP
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/tcp.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef BENCH_SERVER
+#define BENCH_SERVER            "[::1]:5001"
+#endif
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES             (256U * 1024U)
+#endif
+
+#define BENCH_PORT              (5001U)
+#define BENCH_CHUNK_MAX         (4096U)
+#define BENCH_TIMEOUT_MS        (10U * MS_PER_SEC)
+
+#define FLAG_DONE               (0x1)
+
+static const uint16_t _chunks[] = { 64, 512, BENCH_CHUNK_MAX };
+
+static uint8_t _buf[BENCH_CHUNK_MAX];
+static uint8_t _rcv_buf[BENCH_CHUNK_MAX];
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static gnrc_tcp_tcb_t _server_tcb;
+static gnrc_tcp_tcb_t _client_tcb;
+static thread_t *_main;
+static uint16_t _chunk;
+
+static void _print_result(const char *dir, uint32_t bytes, uint32_t ms)
+{
+    /* kbit/s = bytes * 8 / ms */
+    uint32_t kbit_s = ms ? (uint32_t)(((uint64_t)bytes * 8) / ms) : 0;
+
+    printf("{ \"name\" : \"%s %u\", \"bytes\" : %" PRIu32 ", \"ms\" : %" PRIu32
+           ", \"kbit_s\" : %" PRIu32 " }\n", dir, _chunk, bytes, ms, kbit_s);
+}
+
+static void *_server(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        gnrc_tcp_tcb_t *tcb;
+        uint32_t bytes = 0;
+        ssize_t res;
+
+        if (gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) < 0) {
+            continue;
+        }
+
+        uint32_t start = ztimer_now(ZTIMER_MSEC);
+        while ((res = gnrc_tcp_recv(tcb, _rcv_buf, sizeof(_rcv_buf),
+                                    BENCH_TIMEOUT_MS)) > 0) {
+            bytes += res;
+        }
+        uint32_t ms = ztimer_now(ZTIMER_MSEC) - start;
+
+        if (res < 0) {
+            printf("recv failed: %d\n", (int)res);
+        }
+        gnrc_tcp_close(tcb);
+        _print_result("recv", bytes, ms);
+        if (_main) {
+            thread_flags_set(_main, FLAG_DONE);
+        }
+    }
+    return NULL;
+}
+
+static int _send(const gnrc_tcp_ep_t *remote, uint16_t chunk)
+{
+    uint32_t sent = 0;
+    int res;
+
+    gnrc_tcp_tcb_init(&_client_tcb);
+    if ((res = gnrc_tcp_open(&_client_tcb, remote, 0)) < 0) {
+        printf("open failed: %d\n", res);
+        return res;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    while (sent < BENCH_BYTES) {
+        size_t len = BENCH_BYTES - sent;
+        ssize_t n = gnrc_tcp_send(&_client_tcb, _buf, (len < chunk) ? len : chunk,
+                                  BENCH_TIMEOUT_MS);
+
+        if (n < 0) {
+            printf("send failed: %d\n", (int)n);
+            gnrc_tcp_abort(&_client_tcb);
+            return n;
+        }
+        sent += n;
+    }
+    /* returns once everything, including the FIN, was acknowledged */
+    gnrc_tcp_close(&_client_tcb);
+    _print_result("send", sent, ztimer_now(ZTIMER_MSEC) - start);
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_ep_t remote;
+    bool loopback;
+
+    memset(_buf, 'x', sizeof(_buf));
+
+    gnrc_tcp_ep_from_str(&local, "[::]");
+    local.port = BENCH_PORT;
+    if (gnrc_tcp_ep_from_str(&remote, BENCH_SERVER) < 0) {
+        puts("invalid BENCH_SERVER");
+        return 1;
+    }
+    loopback = ipv6_addr_is_loopback((ipv6_addr_t *)remote.addr.ipv6);
+
+    gnrc_tcp_tcb_init(&_server_tcb);
+    if (gnrc_tcp_listen(&_queue, &_server_tcb, 1, &local) < 0) {
+        puts("listen failed");
+        return 1;
+    }
+    if (loopback) {
+        _main = thread_get_active();
+    }
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server, NULL, "bench_server");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        _chunk = _chunks[i];
+        if (_send(&remote, _chunk) < 0) {
+            break;
+        }
+        if (loopback) {
+            thread_flags_wait_any(FLAG_DONE);
+        }
+    }
+    puts("done");
+
+    /* keep the receiver running for other instances */
+    if (!loopback) {
+        thread_sleep();
+    }
+    return 0;
+}
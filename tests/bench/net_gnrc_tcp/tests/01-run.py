@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+CHUNKS = (64, 512, 4096)
+RESULT = (r"{ \"name\" : \"%s %d\", \"bytes\" : \d+, \"ms\" : \d+, "
+          r"\"kbit_s\" : \d+ }")
+
+
+def testfunc(child):
+    for chunk in CHUNKS:
+        child.expect(RESULT % ("(send|recv)", chunk))
+        child.expect(RESULT % ("(send|recv)", chunk))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
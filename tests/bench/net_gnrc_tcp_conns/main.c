@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures how a single thread serves many GNRC TCP connections
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/async/event.h"
+#include "net/sock/tcp.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef BENCH_CONNS
+#define BENCH_CONNS             (4U)
+#endif
+
+#ifndef BENCH_QUEUE_LEN
+#define BENCH_QUEUE_LEN         (2U)
+#endif
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES             (64U * 1024U)
+#endif
+
+#define BENCH_PORT              (5002U)
+#define BENCH_CHUNK             (512U)
+
+#define FLAG_DONE               (0x1)
+
+static uint8_t _buf[BENCH_CHUNK];
+static uint8_t _rcv_buf[BENCH_CHUNK];
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static char _client_stacks[BENCH_CONNS][THREAD_STACKSIZE_DEFAULT];
+
+static event_queue_t _ev_queue;
+static sock_tcp_queue_t _queue;
+static sock_tcp_t _queue_socks[BENCH_QUEUE_LEN];
+static bool _open[BENCH_QUEUE_LEN];
+static sock_tcp_t _client_socks[BENCH_CONNS];
+static thread_t *_main;
+
+/* results, counted by the server thread */
+static uint32_t _bytes;
+static unsigned _served;
+static unsigned _open_now;
+static unsigned _open_max;
+static uint32_t _end;
+/* number of clients that failed, counted by the client threads */
+static unsigned _failed;
+
+static void _close(sock_tcp_t *sock)
+{
+    _open[sock - _queue_socks] = false;
+    _open_now--;
+    sock_tcp_disconnect(sock);
+
+    if (++_served == BENCH_CONNS - _failed) {
+        _end = ztimer_now(ZTIMER_MSEC);
+        thread_flags_set(_main, FLAG_DONE);
+    }
+}
+
+static void _recv(sock_tcp_t *sock)
+{
+    ssize_t res;
+
+    if (!_open[sock - _queue_socks]) {
+        return;
+    }
+    while ((res = sock_tcp_read(sock, _rcv_buf, sizeof(_rcv_buf), 0)) > 0) {
+        _bytes += res;
+    }
+    /* 0 once the client closed the connection */
+    if (res != -EAGAIN) {
+        _close(sock);
+    }
+}
+
+static void _sock_handler(sock_tcp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)arg;
+
+    if (flags & (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_CONN_FIN)) {
+        _recv(sock);
+    }
+}
+
+static void _queue_handler(sock_tcp_queue_t *queue, sock_async_flags_t flags,
+                           void *arg)
+{
+    sock_tcp_t *sock;
+
+    (void)arg;
+    if (!(flags & SOCK_ASYNC_CONN_RECV)) {
+        return;
+    }
+    while (sock_tcp_accept(queue, &sock, 0) == 0) {
+        _open[sock - _queue_socks] = true;
+        if (++_open_now > _open_max) {
+            _open_max = _open_now;
+        }
+        sock_tcp_event_init(sock, &_ev_queue, _sock_handler, NULL);
+        /* data received before the handler was set is not reported */
+        _recv(sock);
+    }
+}
+
+static void *_server(void *arg)
+{
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    (void)arg;
+    local.port = BENCH_PORT;
+
+    event_queue_init(&_ev_queue);
+    if (sock_tcp_listen(&_queue, &local, _queue_socks, BENCH_QUEUE_LEN, 0) < 0) {
+        puts("listen failed");
+        return NULL;
+    }
+    sock_tcp_queue_event_init(&_queue, &_ev_queue, _queue_handler, NULL);
+    thread_flags_set(_main, FLAG_DONE);
+    event_loop(&_ev_queue);
+    return NULL;
+}
+
+static void *_client(void *arg)
+{
+    sock_tcp_t *sock = arg;
+    sock_tcp_ep_t remote = { .family = AF_INET6, .port = BENCH_PORT };
+    uint32_t sent = 0;
+    int res;
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    if ((res = sock_tcp_connect(sock, &remote, 0, 0)) < 0) {
+        printf("connect failed: %d\n", res);
+        goto fail;
+    }
+    while (sent < BENCH_BYTES) {
+        size_t len = BENCH_BYTES - sent;
+        ssize_t n = sock_tcp_write(sock, _buf, (len < BENCH_CHUNK) ? len : BENCH_CHUNK);
+
+        if (n < 0) {
+            printf("write failed: %d\n", (int)n);
+            sock_tcp_disconnect(sock);
+            goto fail;
+        }
+        sent += n;
+        /* over loopback, everything but the client runs at higher priority,
+         * so let the other clients interleave as they would on a network */
+        thread_yield();
+    }
+    sock_tcp_disconnect(sock);
+    return NULL;
+
+fail:
+    _failed++;
+    return NULL;
+}
+
+int main(void)
+{
+    memset(_buf, 'x', sizeof(_buf));
+    _main = thread_get_active();
+
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server, NULL, "bench_server");
+    thread_flags_wait_any(FLAG_DONE);
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < BENCH_CONNS; i++) {
+        thread_create(_client_stacks[i], sizeof(_client_stacks[i]), THREAD_PRIORITY_MAIN,
+                      0, _client, &_client_socks[i], "bench_client");
+    }
+    thread_flags_wait_any(FLAG_DONE);
+
+    uint32_t ms = _end - start;
+    /* kbit/s = bytes * 8 / ms */
+    uint32_t kbit_s = ms ? (uint32_t)(((uint64_t)_bytes * 8) / ms) : 0;
+
+    printf("{ \"name\" : \"conns %u\", \"served\" : %u, \"failed\" : %u, "
+           "\"open_max\" : %u, \"bytes\" : %" PRIu32 ", \"ms\" : %" PRIu32
+           ", \"kbit_s\" : %" PRIu32 " }\n", BENCH_CONNS, _served, _failed,
+           _open_max, _bytes, ms, kbit_s);
+    puts("done");
+    return 0;
+}
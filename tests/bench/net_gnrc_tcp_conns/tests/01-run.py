@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+RESULT = (r"{ \"name\" : \"conns (\d+)\", \"served\" : (\d+), \"failed\" : 0, "
+          r"\"open_max\" : \d+, \"bytes\" : \d+, \"ms\" : \d+, \"kbit_s\" : \d+ }")
+
+
+def testfunc(child):
+    child.expect(RESULT)
+    assert child.match.group(1) == child.match.group(2)
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
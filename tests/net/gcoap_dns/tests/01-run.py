@@ -176,6 +176,45 @@ class TestGCoAPDNS(PexpectTestCase):
             self.spawn.sendline("query example.org inet6")
             self.spawn.expect_exact("Bad message")
 
+    def test_doc_negative(self):
+        self._set_resp(
+            2,
+            1,
+            DNS(
+                qr=1,
+                rcode="name-error",
+                qd=[DNSQR(qname="nx.example.org", qtype="AAAA")],
+            ),
+        )
+        self.spawn.sendline("uri coap://[::1]")
+        self.spawn.expect_exact("Successfully added URI coap://[::1]")
+        self.spawn.sendline("query nx.example.org")
+        self.spawn.expect_exact("No such file or directory")
+        self._set_resp(
+            2,
+            1,
+            DNS(
+                qr=1,
+                qd=[DNSQR(qname="nx.example.org", qtype="AAAA")],
+                ancount=1,  # ancount needs to be set since `an` is already encoded
+                an=(
+                    # already encoding
+                    # [DNSRR(ttl=300, type="AAAA", rdata="2001:db8::1")]
+                    # to make older scapy version on Murdock happy
+                    b"\x00\x00\x1c\x00\x01\x00\x00\x01,\x00\x10 \x01\r\xb8\x00\x00"
+                    b"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01"
+                ),
+            ),
+        )
+        self.spawn.sendline("query nx.example.org")
+        if self.has_dns_cache():
+            # the negative answer is still cached
+            self.spawn.expect_exact("No such file or directory")
+        else:
+            self.spawn.expect_exact(
+                "Hostname nx.example.org resolves to 2001:db8::1 (IPv6)"
+            )
+
     def _expect_od_dump_of(self, hexbytes):
         for i in range((len(hexbytes) // 32) + 1):
             rang = hexbytes[(i * 32) : ((i * 32) + 32)]  # noqa: E203
@@ -1,5 +1,6 @@
 /*
  * SPDX-FileCopyrightText: 2024 ML!PA Consulting GmbH
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
  * SPDX-License-Identifier: LGPL-2.1-only
  */
 
@@ -10,22 +11,210 @@
  * @file
  * @brief       test application for the GCoAP forward proxy
  *
+ * Clients and the origin server are sockets talking to the proxy over the
+ * loopback address.
+ *
  * @author      Marian Buschsieweke <marian.buschsieweke@posteo.net>
  * @}
  */
 
-#include "msg.h"
-#include "shell.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gcoap.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#define CLIENTS_NUMOF       (CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX + 1)
+#define CLIENT_PORT         (40001U)
+#define ORIGIN_PORT         (40100U)
+#define ORIGIN_URI          "coap://[::1]:40100/res"
+#define RECV_TIMEOUT_US     (100U * US_PER_MS)
+#define RESP_PAYLOAD        "hello"
+
+static const sock_udp_ep_t _proxy = {
+    .family = AF_INET6,
+    .addr = { .ipv6 = { [15] = 1 } },   /* ::1 */
+    .port = CONFIG_GCOAP_PORT,
+};
+
+static sock_udp_t _clients[CLIENTS_NUMOF];
+static sock_udp_t _origin;
+static uint16_t _mid;
+
+/* sends a GET for ORIGIN_URI with the given query via the proxy, the token
+ * and message ID tell the requests of all clients apart */
+static uint16_t _send(unsigned client, const char *query)
+{
+    uint8_t buf[64];
+    char uri[48];
+    uint16_t mid = ++_mid;
+    const uint8_t token[] = { 0xf0, client, mid >> 8, mid & 0xff };
+    coap_pkt_t pdu;
+
+    snprintf(uri, sizeof(uri), "%s%s%s", ORIGIN_URI, query ? "?" : "",
+             query ? query : "");
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_NON, token,
+                                     sizeof(token), COAP_METHOD_GET, mid);
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    coap_opt_add_proxy_uri(&pdu, uri);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    sock_udp_send(&_clients[client], buf, len, &_proxy);
+    return mid;
+}
+
+/* receives a forwarded request, returns 0 if there was none */
+static ssize_t _origin_recv(uint8_t *buf, size_t len, coap_pkt_t *pdu,
+                            sock_udp_ep_t *remote)
+{
+    ssize_t res = sock_udp_recv(&_origin, buf, len, RECV_TIMEOUT_US, remote);
+
+    if (res == -ETIMEDOUT) {
+        return 0;
+    }
+    if ((res > 0) && (coap_parse(pdu, buf, res) < 0)) {
+        return -EBADMSG;
+    }
+    return res;
+}
+
+/* responds to a forwarded request, with its message ID as the proxy keeps the
+ * one of the server for the client */
+static void _origin_respond(coap_pkt_t *req, const sock_udp_ep_t *remote)
+{
+    uint8_t buf[64];
+    coap_pkt_t pdu;
+
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_NON,
+                                     coap_get_token(req), coap_get_token_len(req),
+                                     COAP_CODE_CONTENT, coap_get_id(req));
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pdu.payload, RESP_PAYLOAD, sizeof(RESP_PAYLOAD) - 1);
+    sock_udp_send(&_origin, buf, len + sizeof(RESP_PAYLOAD) - 1, remote);
+}
+
+/* receives and responds to the given number of forwarded requests and checks
+ * that no more were sent */
+static void _origin_serve(unsigned num)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    sock_udp_ep_t remote;
+    coap_pkt_t pdu;
+
+    for (unsigned i = 0; i < num; i++) {
+        TEST_ASSERT(_origin_recv(buf, sizeof(buf), &pdu, &remote) > 0);
+        TEST_ASSERT_EQUAL_INT(COAP_METHOD_GET, coap_get_code_raw(&pdu));
+        _origin_respond(&pdu, &remote);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _origin_recv(buf, sizeof(buf), &pdu, &remote));
+}
+
+/* checks the response of the proxy to the request of client with mid */
+static void _expect_resp(unsigned client, uint16_t mid, unsigned code)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    const uint8_t token[] = { 0xf0, client, mid >> 8, mid & 0xff };
+    coap_pkt_t pdu;
+
+    ssize_t len = sock_udp_recv(&_clients[client], buf, sizeof(buf),
+                                RECV_TIMEOUT_US, NULL);
+    TEST_ASSERT(len > 0);
+    TEST_ASSERT(coap_parse(&pdu, buf, len) >= 0);
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_NON, coap_get_type(&pdu));
+    TEST_ASSERT_EQUAL_INT(code, coap_get_code_raw(&pdu));
+    TEST_ASSERT_EQUAL_INT(sizeof(token), coap_get_token_len(&pdu));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(coap_get_token(&pdu), token, sizeof(token)));
+    if (code == COAP_CODE_CONTENT) {
+        TEST_ASSERT_EQUAL_INT(mid, coap_get_id(&pdu));
+        TEST_ASSERT_EQUAL_INT(sizeof(RESP_PAYLOAD) - 1, pdu.payload_len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(pdu.payload, RESP_PAYLOAD, pdu.payload_len));
+    }
+}
+
+static void test_coalesce__identical(void)
+{
+    uint16_t mid0 = _send(0, NULL);
+    uint16_t mid1 = _send(1, NULL);
+
+    _origin_serve(1);
+    _expect_resp(0, mid0, COAP_CODE_CONTENT);
+    _expect_resp(1, mid1, COAP_CODE_CONTENT);
+}
+
+static void test_coalesce__different(void)
+{
+    uint16_t mid0 = _send(0, "q=a");
+    uint16_t mid1 = _send(1, "q=b");
+
+    _origin_serve(2);
+    _expect_resp(0, mid0, COAP_CODE_CONTENT);
+    _expect_resp(1, mid1, COAP_CODE_CONTENT);
+}
+
+static void test_coalesce__hash_collision(void)
+{
+    /* both forwarded requests have the same FNV-1a hash with server ::1 */
+    uint16_t mid0 = _send(0, "q=aalrnw");
+    uint16_t mid1 = _send(1, "q=aa4pba");
+
+    _origin_serve(2);
+    _expect_resp(0, mid0, COAP_CODE_CONTENT);
+    _expect_resp(1, mid1, COAP_CODE_CONTENT);
+}
+
+static void test_clients_full(void)
+{
+    uint16_t mids[CLIENTS_NUMOF];
+
+    /* one request to the server, the others wait for its response */
+    for (unsigned i = 0; i < CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX; i++) {
+        mids[i] = _send(i, NULL);
+    }
+    mids[CLIENTS_NUMOF - 1] = _send(CLIENTS_NUMOF - 1, NULL);
+    _expect_resp(CLIENTS_NUMOF - 1, mids[CLIENTS_NUMOF - 1],
+                 COAP_CODE_INTERNAL_SERVER_ERROR);
+
+    _origin_serve(1);
+    for (unsigned i = 0; i < CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX; i++) {
+        _expect_resp(i, mids[i], COAP_CODE_CONTENT);
+    }
+
+    /* the slots are free again */
+    mids[CLIENTS_NUMOF - 1] = _send(CLIENTS_NUMOF - 1, NULL);
+    _origin_serve(1);
+    _expect_resp(CLIENTS_NUMOF - 1, mids[CLIENTS_NUMOF - 1], COAP_CODE_CONTENT);
+}
+
+static Test *tests_gcoap_forward_proxy(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_coalesce__identical),
+        new_TestFixture(test_coalesce__different),
+        new_TestFixture(test_coalesce__hash_collision),
+        new_TestFixture(test_clients_full),
+    };
 
-#define MAIN_QUEUE_SIZE (4)
-static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+    EMB_UNIT_TESTCALLER(gcoap_forward_proxy_tests, NULL, NULL, fixtures);
+
+    return (Test *)&gcoap_forward_proxy_tests;
+}
 
 int main(void)
 {
-    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    sock_udp_ep_t local = { .family = AF_INET6, .port = ORIGIN_PORT };
+
+    sock_udp_create(&_origin, &local, NULL, 0);
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        local.port = CLIENT_PORT + i;
+        sock_udp_create(&_clients[i], &local, NULL, 0);
+    }
 
-    char line_buf[SHELL_DEFAULT_BUFSIZE];
-    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+    TESTS_START();
+    TESTS_RUN(tests_gcoap_forward_proxy());
+    TESTS_END();
 
     return 0;
 }
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests gcoap processing requests in the GNRC packet buffer
+ *
+ * A client socket talks to gcoap over the loopback address. A second
+ * registration for the CoAP port gets every request gcoap gets, sharing the
+ * same packet, to check that it is not modified while gcoap processes it.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gcoap.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#define CLIENT_PORT         (40001U)
+#define RECV_TIMEOUT_US     (100U * US_PER_MS)
+#define MSG_QUEUE_SIZE      (8U)
+
+static const sock_udp_ep_t _gcoap = {
+    .family = AF_INET6,
+    .addr = { .ipv6 = { [15] = 1 } },   /* ::1 */
+    .port = CONFIG_GCOAP_PORT,
+};
+
+static const sock_udp_ep_t _server = {
+    .family = AF_INET6,
+    .addr = { .ipv6 = { [15] = 1 } },   /* ::1 */
+    .port = CLIENT_PORT,
+};
+
+static const uint8_t _token[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _snoop = GNRC_NETREG_ENTRY_INIT_PID(CONFIG_GCOAP_PORT,
+                                                               KERNEL_PID_UNDEF);
+static sock_udp_t _sock;
+
+/* buffers the echo handler got the request in and wrote the response to */
+static struct {
+    const uint8_t *req;
+    const uint8_t *resp;
+} _echo_bufs;
+
+/* state of the response handler of gcoap requests */
+static struct {
+    unsigned calls;
+    unsigned code;
+} _resp;
+
+static ssize_t _echo_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    uint8_t payload[CONFIG_GCOAP_PDU_BUF_SIZE];
+    size_t payload_len = pdu->payload_len;
+
+    _echo_bufs.req = pdu->buf;
+    _echo_bufs.resp = buf;
+    /* read the request before writing the response */
+    memcpy(payload, pdu->payload, payload_len);
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CHANGED);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    if (pdu->payload_len < payload_len) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_INTERNAL_SERVER_ERROR);
+    }
+    memcpy(pdu->payload, payload, payload_len);
+    return resp_len + payload_len;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/echo", COAP_POST, _echo_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+
+    _resp.calls++;
+    _resp.code = (memo->state == GCOAP_MEMO_RESP) ? coap_get_code_raw(pdu) : 0;
+}
+
+static size_t _build_request(uint8_t *buf, size_t buf_len, unsigned type,
+                             const char *path, size_t payload_len)
+{
+    coap_pkt_t pdu;
+
+    ssize_t len = coap_build_udp_hdr(buf, buf_len, type, _token, sizeof(_token),
+                                     COAP_METHOD_POST, 0x4242);
+    coap_pkt_init(&pdu, buf, buf_len, len);
+    coap_opt_add_uri_path(&pdu, path);
+    coap_opt_add_format(&pdu, COAP_FORMAT_OCTET);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    for (size_t i = 0; i < payload_len; i++) {
+        pdu.payload[i] = i;
+    }
+    return len + payload_len;
+}
+
+/* receives a message on the client socket and parses it */
+static ssize_t _recv(uint8_t *buf, size_t len, coap_pkt_t *pdu)
+{
+    ssize_t res = sock_udp_recv(&_sock, buf, len, RECV_TIMEOUT_US, NULL);
+
+    if ((res > 0) && (coap_parse(pdu, buf, res) < 0)) {
+        return -EBADMSG;
+    }
+    return res;
+}
+
+/* checks that the packet gcoap received is still the one that was sent */
+static void _check_snooped(const uint8_t *sent, size_t len)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+
+    gnrc_pktsnip_t *pkt = msg.content.ptr;
+    size_t snooped_len = pkt->size;
+    int cmp = memcmp(pkt->data, sent, MIN(len, pkt->size));
+    gnrc_pktbuf_release(pkt);
+
+    TEST_ASSERT_EQUAL_INT(len, snooped_len);
+    TEST_ASSERT_EQUAL_INT(0, cmp);
+}
+
+/* checks that an empty message of the given type and ID was received */
+static void _expect_empty(unsigned type, uint16_t mid)
+{
+    uint8_t buf[32];
+    coap_pkt_t pdu;
+
+    TEST_ASSERT_EQUAL_INT(sizeof(coap_udp_hdr_t), _recv(buf, sizeof(buf), &pdu));
+    TEST_ASSERT_EQUAL_INT(type, coap_get_type(&pdu));
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_EMPTY, coap_get_code_raw(&pdu));
+    TEST_ASSERT_EQUAL_INT(0, coap_get_token_len(&pdu));
+    TEST_ASSERT_EQUAL_INT(mid, coap_get_id(&pdu));
+}
+
+static void setup(void)
+{
+    msg_t msg;
+
+    memset(&_echo_bufs, 0, sizeof(_echo_bufs));
+    memset(&_resp, 0, sizeof(_resp));
+    _snoop.target.pid = thread_getpid();
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_snoop);
+    while (msg_try_receive(&msg) == 1) {}
+}
+
+static void teardown(void)
+{
+    msg_t msg;
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_snoop);
+    while (msg_try_receive(&msg) == 1) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+}
+
+static void test_in_place__request(void)
+{
+    uint8_t req[96];
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    size_t len = _build_request(req, sizeof(req), COAP_TYPE_CON, "/echo", 64);
+
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_sock, req, len, &_gcoap));
+    TEST_ASSERT(_recv(buf, sizeof(buf), &pdu) > 0);
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_ACK, coap_get_type(&pdu));
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_CHANGED, coap_get_code_raw(&pdu));
+    TEST_ASSERT_EQUAL_INT(0x4242, coap_get_id(&pdu));
+    TEST_ASSERT_EQUAL_INT(sizeof(_token), coap_get_token_len(&pdu));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(coap_get_token(&pdu), _token, sizeof(_token)));
+    TEST_ASSERT_EQUAL_INT(64, pdu.payload_len);
+    for (unsigned i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL_INT(i, pdu.payload[i]);
+    }
+
+    /* the request was not copied to the response buffer */
+    TEST_ASSERT_NOT_NULL(_echo_bufs.req);
+    TEST_ASSERT(_echo_bufs.req != _echo_bufs.resp);
+    _check_snooped(req, len);
+}
+
+static void test_in_place__error_response(void)
+{
+    uint8_t req[96];
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    size_t len = _build_request(req, sizeof(req), COAP_TYPE_NON, "/missing", 16);
+
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_sock, req, len, &_gcoap));
+    TEST_ASSERT(_recv(buf, sizeof(buf), &pdu) > 0);
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_NON, coap_get_type(&pdu));
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_PATH_NOT_FOUND, coap_get_code_raw(&pdu));
+    TEST_ASSERT_NULL(_echo_bufs.req);
+    _check_snooped(req, len);
+}
+
+static void test_in_place__too_large(void)
+{
+    static uint8_t req[CONFIG_GCOAP_PDU_BUF_SIZE + 32];
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    size_t len = _build_request(req, sizeof(req), COAP_TYPE_CON, "/echo",
+                                CONFIG_GCOAP_PDU_BUF_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_sock, req, len, &_gcoap));
+    TEST_ASSERT(_recv(buf, sizeof(buf), &pdu) > 0);
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_REQUEST_ENTITY_TOO_LARGE, coap_get_code_raw(&pdu));
+    TEST_ASSERT_NULL(_echo_bufs.req);
+    _check_snooped(req, len);
+}
+
+static void test_empty__ping(void)
+{
+    uint8_t req[sizeof(coap_udp_hdr_t)];
+
+    coap_build_udp_hdr(req, sizeof(req), COAP_TYPE_CON, NULL, 0, COAP_CODE_EMPTY,
+                       0x1234);
+    TEST_ASSERT_EQUAL_INT(sizeof(req), sock_udp_send(&_sock, req, sizeof(req), &_gcoap));
+    _expect_empty(COAP_TYPE_RST, 0x1234);
+    _check_snooped(req, sizeof(req));
+}
+
+static void test_empty__ack_separate_response(void)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t resp[32];
+    sock_udp_ep_t remote;
+    coap_pkt_t pdu;
+
+    /* gcoap requests from this socket */
+    gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, "/separate");
+    coap_pkt_set_type(&pdu, COAP_TYPE_CON);
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT(gcoap_req_send(buf, len, &_server, NULL, _resp_handler, NULL,
+                               GCOAP_SOCKET_TYPE_UDP) > 0);
+    len = sock_udp_recv(&_sock, buf, sizeof(buf), RECV_TIMEOUT_US, &remote);
+    TEST_ASSERT(len > 0);
+    TEST_ASSERT(coap_parse(&pdu, buf, len) >= 0);
+
+    /* acknowledge it and send the response later, confirmable */
+    coap_build_udp_hdr(resp, sizeof(resp), COAP_TYPE_ACK, NULL, 0,
+                       COAP_CODE_EMPTY, coap_get_id(&pdu));
+    sock_udp_send(&_sock, resp, sizeof(coap_udp_hdr_t), &remote);
+    len = coap_build_udp_hdr(resp, sizeof(resp), COAP_TYPE_CON,
+                             coap_get_token(&pdu), coap_get_token_len(&pdu),
+                             COAP_CODE_CONTENT, 0x5678);
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_sock, resp, len, &remote));
+
+    _expect_empty(COAP_TYPE_ACK, 0x5678);
+    TEST_ASSERT_EQUAL_INT(1, _resp.calls);
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_CONTENT, _resp.code);
+
+    /* the same response again doesn't match a request anymore */
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_sock, resp, len, &remote));
+    _expect_empty(COAP_TYPE_RST, 0x5678);
+    TEST_ASSERT_EQUAL_INT(1, _resp.calls);
+}
+
+static Test *tests_gcoap_in_place(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_in_place__request),
+        new_TestFixture(test_in_place__error_response),
+        new_TestFixture(test_in_place__too_large),
+        new_TestFixture(test_empty__ping),
+        new_TestFixture(test_empty__ack_separate_response),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_in_place_tests, setup, teardown, fixtures);
+
+    return (Test *)&gcoap_in_place_tests;
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local = { .family = AF_INET6, .port = CLIENT_PORT };
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gcoap_register_listener(&_listener);
+    sock_udp_create(&_sock, &local, NULL, 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_gcoap_in_place());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests Observe notifications of gcoap to several observers
+ *
+ * The observers are plain UDP sockets talking to gcoap over the loopback
+ * address. They register with their own token and check every notification
+ * they receive.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "fmt.h"
+#include "net/gcoap.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#define OBSERVERS_NUMOF     (3U)
+#define OBSERVER_PORT       (40001U)
+/* time to wait for a notification that is expected */
+#define RECV_TIMEOUT_US     (100U * US_PER_MS)
+/* time to wait for a notification that must not arrive */
+#define NO_RECV_TIMEOUT_US  (20U * US_PER_MS)
+
+static uint32_t _value;
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_TEXT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    return resp_len + fmt_u32_dec((char *)pdu->payload, _value);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/value", COAP_GET, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static const sock_udp_ep_t _server = {
+    .family = AF_INET6,
+    .addr = { .ipv6 = { [15] = 1 } },   /* ::1 */
+    .port = CONFIG_GCOAP_PORT,
+};
+
+static sock_udp_t _observers[OBSERVERS_NUMOF];
+static uint16_t _next_mid;
+
+static uint8_t _token(unsigned observer)
+{
+    return 0xa0 + observer;
+}
+
+static void _request(unsigned observer, uint32_t observe)
+{
+    uint8_t buf[64];
+    uint8_t token = _token(observer);
+    coap_pkt_t pdu;
+
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_CON, &token, 1,
+                                     COAP_METHOD_GET, _next_mid++);
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, observe);
+    coap_opt_add_uri_path(&pdu, "/value");
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_observers[observer], buf, len, &_server));
+
+    len = sock_udp_recv(&_observers[observer], buf, sizeof(buf), RECV_TIMEOUT_US, NULL);
+    TEST_ASSERT(len > 0);
+    TEST_ASSERT(coap_parse(&pdu, buf, len) >= 0);
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_ACK, coap_get_type(&pdu));
+    TEST_ASSERT_EQUAL_INT(COAP_CODE_CONTENT, coap_get_code_raw(&pdu));
+}
+
+static void _register(unsigned observer)
+{
+    _request(observer, COAP_OBS_REGISTER);
+}
+
+static void _deregister(unsigned observer)
+{
+    _request(observer, COAP_OBS_DEREGISTER);
+}
+
+/* sends a notification, returns the result of gcoap_obs_send() */
+static ssize_t _notify(void)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    _value++;
+    if (gcoap_obs_init(&pdu, buf, sizeof(buf), &_resources[0]) != GCOAP_OBS_INIT_OK) {
+        return -ENOENT;
+    }
+    coap_opt_add_format(&pdu, COAP_FORMAT_TEXT);
+    size_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    len += fmt_u32_dec((char *)pdu.payload, _value);
+    return gcoap_obs_send(buf, len, &_resources[0]);
+}
+
+/*
+ * Receives a notification of the observer and checks token and payload.
+ * Returns the message type, -ETIMEDOUT if there was none or -EBADMSG if
+ * it is not the expected one.
+ */
+static int _recv_notification(unsigned observer, uint16_t *mid)
+{
+    uint8_t buf[64];
+    char value[10];
+    coap_pkt_t pdu;
+
+    ssize_t len = sock_udp_recv(&_observers[observer], buf, sizeof(buf),
+                                *mid ? NO_RECV_TIMEOUT_US : RECV_TIMEOUT_US, NULL);
+    if (len < 0) {
+        return -ETIMEDOUT;
+    }
+    if ((coap_parse(&pdu, buf, len) < 0) || (coap_get_token_len(&pdu) != 1) ||
+        (*(uint8_t *)coap_get_token(&pdu) != _token(observer)) || !coap_has_observe(&pdu)) {
+        return -EBADMSG;
+    }
+    if ((pdu.payload_len != fmt_u32_dec(value, _value)) ||
+        memcmp(pdu.payload, value, pdu.payload_len)) {
+        return -EBADMSG;
+    }
+    *mid = coap_get_id(&pdu);
+    return coap_get_type(&pdu);
+}
+
+/* checks that the observer receives a notification of the given type */
+static void _expect_notification(unsigned observer, int type)
+{
+    uint16_t mid = 0;
+
+    TEST_ASSERT_EQUAL_INT(type, _recv_notification(observer, &mid));
+}
+
+static void _ack(unsigned observer, uint16_t mid)
+{
+    uint8_t buf[4];
+
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_ACK, NULL, 0,
+                                     COAP_CODE_EMPTY, mid);
+    TEST_ASSERT_EQUAL_INT(len, sock_udp_send(&_observers[observer], buf, len, &_server));
+    /* let gcoap process the ACK */
+    ztimer_sleep(ZTIMER_MSEC, 10);
+}
+
+/* checks that the observer receives a confirmable notification and
+ * acknowledges it */
+static void _expect_con_ack(unsigned observer)
+{
+    uint16_t mid = 0;
+
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_CON, _recv_notification(observer, &mid));
+    _ack(observer, mid);
+}
+
+/* checks that the observer does not receive any notification */
+static void _expect_none(unsigned observer)
+{
+    uint16_t mid = 1;
+
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, _recv_notification(observer, &mid));
+}
+
+static void _wait_ack_timeout(void)
+{
+    ztimer_sleep(ZTIMER_MSEC, CONFIG_GCOAP_OBS_ACK_TIMEOUT_MS + 10);
+}
+
+static void teardown(void)
+{
+    for (unsigned i = 0; i < OBSERVERS_NUMOF; i++) {
+        _deregister(i);
+    }
+}
+
+static void test_observe__fan_out(void)
+{
+    uint16_t mids[OBSERVERS_NUMOF];
+
+    for (unsigned i = 0; i < OBSERVERS_NUMOF; i++) {
+        _register(i);
+    }
+
+    /* the observers don't fit into one batch, every one gets the
+     * notification with its own token and message ID */
+    TEST_ASSERT(_notify() > 0);
+    for (unsigned i = 0; i < OBSERVERS_NUMOF; i++) {
+        mids[i] = 0;
+        TEST_ASSERT_EQUAL_INT(COAP_TYPE_NON, _recv_notification(i, &mids[i]));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(mids[i] != mids[j]);
+        }
+        _expect_none(i);
+    }
+}
+
+static void test_observe__con_interval(void)
+{
+    _register(0);
+    _register(1);
+
+    /* every second notification is confirmable */
+    for (unsigned n = 0; n < 2; n++) {
+        TEST_ASSERT(_notify() > 0);
+        _expect_notification(0, COAP_TYPE_NON);
+        _expect_notification(1, COAP_TYPE_NON);
+
+        TEST_ASSERT(_notify() > 0);
+        _expect_con_ack(0);
+        _expect_con_ack(1);
+    }
+}
+
+static void test_observe__con_pending(void)
+{
+    _register(0);
+    _register(1);
+
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_NON);
+    _expect_notification(1, COAP_TYPE_NON);
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_CON);
+    _expect_con_ack(1);
+
+    /* no notifications pile up on an observer not acknowledging yet */
+    TEST_ASSERT(_notify() > 0);
+    _expect_none(0);
+    _expect_notification(1, COAP_TYPE_NON);
+
+    /* the next one after the timeout is confirmable again */
+    _wait_ack_timeout();
+    TEST_ASSERT(_notify() > 0);
+    _expect_con_ack(0);
+    _expect_con_ack(1);
+
+    /* the acknowledgement reset the failures */
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_NON);
+    _expect_notification(1, COAP_TYPE_NON);
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_CON);
+    _expect_con_ack(1);
+    _wait_ack_timeout();
+    TEST_ASSERT(_notify() > 0);
+    _expect_con_ack(0);
+    _expect_notification(1, COAP_TYPE_NON);
+}
+
+static void test_observe__con_fails_max(void)
+{
+    _register(0);
+    _register(1);
+
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_NON);
+    _expect_notification(1, COAP_TYPE_NON);
+
+    /* observer 0 never acknowledges */
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_CON);
+    _expect_con_ack(1);
+    _wait_ack_timeout();
+    TEST_ASSERT(_notify() > 0);
+    _expect_notification(0, COAP_TYPE_CON);
+    _expect_notification(1, COAP_TYPE_NON);
+    _wait_ack_timeout();
+
+    /* after CONFIG_GCOAP_OBS_CON_FAILS_MAX (2) unacknowledged ones it is
+     * removed, the other observer keeps getting notifications */
+    TEST_ASSERT(_notify() > 0);
+    _expect_none(0);
+    _expect_con_ack(1);
+    TEST_ASSERT(_notify() > 0);
+    _expect_none(0);
+    _expect_notification(1, COAP_TYPE_NON);
+
+    /* without any observer left, there is nothing to notify */
+    _deregister(1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _notify());
+}
+
+static Test *tests_observe(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_observe__fan_out),
+        new_TestFixture(test_observe__con_interval),
+        new_TestFixture(test_observe__con_pending),
+        new_TestFixture(test_observe__con_fails_max),
+    };
+
+    EMB_UNIT_TESTCALLER(observe_tests, NULL, teardown, fixtures);
+
+    return (Test *)&observe_tests;
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+    for (unsigned i = 0; i < OBSERVERS_NUMOF; i++) {
+        const sock_udp_ep_t local = {
+            .family = AF_INET6,
+            .port = OBSERVER_PORT + i,
+        };
+        sock_udp_create(&_observers[i], &local, NULL, 0);
+    }
+
+    TESTS_START();
+    TESTS_RUN(tests_observe());
+    TESTS_END();
+
+    return 0;
+}